@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Runs the body a few times and keeps the fastest, in seconds
+template<typename Body>
+double timeBest(int runs, Body&& body)
+{
+	double best = 1e30;
+	for (int i = 0; i < runs; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		body();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		if (elapsed.count() < best)
+			best = elapsed.count();
+	}
+	return best;
+}
+
+// Keeps results observable so the optimizer cannot drop the measured work
+inline volatile uint64_t benchSink = 0;
+
+inline void report(const std::string& name, double seconds, double items, const char* unit)
+{
+	std::cout << name << ": " << (uint64_t)(items / seconds) << " " << unit << "/s (" << seconds * 1000.0 << " ms)" << std::endl;
+}
+
+void runKeywordBench(int argc, char* args[]);
+void runParallelBench(int argc, char* args[]);
+void runParserBench(int argc, char* args[]);
+void runTokenizerBench(int argc, char* args[]);
+void runCorpus(int argc, char* args[]);
@@ -0,0 +1,185 @@
+#include "Corpus.h"
+
+#include "../../Pengo/src/tokenizer/Keywords.h"
+
+#include <random>
+
+static const std::pair<const char*, CorpusShape> shapes[] = {
+	{"identifiers", CorpusShape::Identifiers},
+	{"strings", CorpusShape::Strings},
+	{"comments", CorpusShape::Comments},
+	{"nested", CorpusShape::Nested},
+	{"mixed", CorpusShape::Mixed},
+	{"unicode", CorpusShape::Unicode},
+};
+
+// Two, three and four byte UTF-8 characters, written as bytes so the compiler's
+// source character set does not matter
+static const char* const characters[] = {
+	"\xC3\xA9", // e with acute
+	"\xC3\x9F", // sharp s
+	"\xCE\xBB", // lambda
+	"\xD0\x96", // zhe
+	"\xE6\x95\xB0", // number
+	"\xE2\x82\xAC", // euro sign
+	"\xF0\x9F\x90\xA7", // penguin
+};
+
+const char* corpusShapeName(CorpusShape shape)
+{
+	for (auto& entry : shapes)
+		if (entry.second == shape)
+			return entry.first;
+	return "unknown";
+}
+
+bool corpusShapeFromName(const std::string& name, CorpusShape& shape)
+{
+	for (auto& entry : shapes)
+		if (name == entry.first)
+		{
+			shape = entry.second;
+			return true;
+		}
+	return false;
+}
+
+class CorpusWriter
+{
+public:
+	CorpusWriter(unsigned seed) : m_random(seed) { }
+
+	std::string source;
+
+	void identifierStatement()
+	{
+		source += identifier() + " = " + identifier() + " + " + identifier() + "(" + identifier() + ", " + number() + ");\n";
+	}
+
+	void stringStatement()
+	{
+		source += "println(" + string() + " + " + string() + ");\n";
+	}
+
+	void commentStatement()
+	{
+		source += "// " + words(between(4, 16)) + "\n";
+		source += identifier() + " = " + number() + ";\n";
+	}
+
+	// Opens depth blocks of ifs and whiles before closing them all again
+	void nestedStatement()
+	{
+		int depth = between(4, 24);
+		for (int i = 0; i < depth; i++)
+		{
+			indent(i);
+			source += (i % 2 ? "while(" : "if(") + identifier() + " < " + number() + ")\n";
+			indent(i);
+			source += "{\n";
+		}
+		indent(depth);
+		identifierStatement();
+		for (int i = depth - 1; i >= 0; i--)
+		{
+			indent(i);
+			source += "}\n";
+		}
+	}
+
+	// Identifiers and strings with multi-byte characters mixed into them
+	void unicodeStatement()
+	{
+		source += unicode(identifier()) + " = " + unicode(identifier()) + " + \"" + unicode(words(between(1, 12))) + "\";\n";
+	}
+
+	void mixedStatement()
+	{
+		switch (between(0, 3))
+		{
+		case 0: identifierStatement(); break;
+		case 1: stringStatement(); break;
+		case 2: commentStatement(); break;
+		case 3: nestedStatement(); break;
+		}
+	}
+private:
+	std::mt19937 m_random;
+
+	int between(int min, int max)
+	{
+		return std::uniform_int_distribution<int>(min, max)(m_random);
+	}
+
+	std::string identifier()
+	{
+		const char* first = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+		const char* rest = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+		std::string name(1, first[between(0, 52)]);
+		for (int i = between(0, 15); i > 0; i--)
+			name.push_back(rest[between(0, 62)]);
+		// Keep keywords out so the token counts stay predictable
+		if (keywordType(name) != TokenType::Identifier)
+			name.push_back('_');
+		return name;
+	}
+
+	std::string number()
+	{
+		std::string value = std::to_string(between(0, 99999));
+		if (between(0, 3) == 0)
+			value += "." + std::to_string(between(0, 999));
+		return value;
+	}
+
+	std::string words(int count)
+	{
+		std::string text;
+		for (int i = 0; i < count; i++)
+			text += (i ? " " : "") + identifier();
+		return text;
+	}
+
+	std::string string()
+	{
+		return "\"" + words(between(1, 12)) + "\"";
+	}
+
+	// Puts a few multi-byte characters anywhere after the first byte
+	std::string unicode(std::string text)
+	{
+		for (int i = between(1, 3); i > 0; i--)
+		{
+			// Not in the middle of a character that is already there
+			size_t at = between(1, (int)text.size());
+			while (at < text.size() && ((unsigned char)text[at] & 0xC0) == 0x80)
+				at++;
+			text.insert(at, characters[between(0, 6)]);
+		}
+		return text;
+	}
+
+	void indent(int depth)
+	{
+		source.append(depth, '\t');
+	}
+};
+
+std::string generateCorpus(CorpusShape shape, size_t bytes, unsigned seed)
+{
+	CorpusWriter writer(seed);
+	writer.source.reserve(bytes + 4096);
+	while (writer.source.size() < bytes)
+	{
+		switch (shape)
+		{
+		case CorpusShape::Identifiers: writer.identifierStatement(); break;
+		case CorpusShape::Strings: writer.stringStatement(); break;
+		case CorpusShape::Comments: writer.commentStatement(); break;
+		case CorpusShape::Nested: writer.nestedStatement(); break;
+		case CorpusShape::Mixed: writer.mixedStatement(); break;
+		case CorpusShape::Unicode: writer.unicodeStatement(); break;
+		}
+	}
+	return writer.source;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Shapes of synthetic Pengo source, each stresses a different tokenizer path
+enum class CorpusShape
+{
+	Identifiers,
+	Strings,
+	Comments,
+	Nested,
+	Mixed,
+	Unicode
+};
+
+const char* corpusShapeName(CorpusShape shape);
+// Returns false for an unknown name
+bool corpusShapeFromName(const std::string& name, CorpusShape& shape);
+
+// Generates at least the given number of bytes of valid Pengo, the same seed
+// always gives the same source
+std::string generateCorpus(CorpusShape shape, size_t bytes, unsigned seed);
@@ -0,0 +1,75 @@
+#include "Bench.h"
+
+#include "../../Pengo/src/tokenizer/Keywords.h"
+
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// The lookup Tokenizer::tokenizeIdentifier used before keywordType, kept as the baseline
+static const std::unordered_map<std::string, TokenType> keywordMap = {
+	{"true", TokenType::Bool},
+	{"false", TokenType::Bool},
+	{"if", TokenType::If},
+	{"elif", TokenType::ElseIf},
+	{"else", TokenType::Else},
+	{"while", TokenType::While},
+	{"func", TokenType::Func},
+	{"return", TokenType::Return},
+	{"break", TokenType::Break},
+	{"continue", TokenType::Continue},
+};
+
+// Bench keywords [identifiers] [keyword percent] [seed]
+void runKeywordBench(int argc, char* args[])
+{
+	size_t count = argc > 2 ? std::stoul(args[2]) : 1000000;
+	int keywordPercent = argc > 3 ? std::stoi(args[3]) : 25;
+	unsigned seed = argc > 4 ? (unsigned)std::stoul(args[4]) : 1;
+
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> percent(0, 99);
+	std::uniform_int_distribution<int> length(1, 12);
+	std::uniform_int_distribution<int> letter(0, 52);
+	const char* letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+
+	std::string source;
+	std::vector<std::pair<size_t, size_t>> words;
+	for (size_t i = 0; i < count; i++)
+	{
+		size_t start = source.size();
+		if (percent(random) < keywordPercent)
+			source.append(keywords[random() % std::size(keywords)].first);
+		else
+			for (int c = length(random); c > 0; c--)
+				source.push_back(letters[letter(random)]);
+		words.push_back({ start, source.size() - start });
+		source.push_back(' ');
+	}
+
+	// The baseline substr'd out of a std::string source like the old tokenizer did
+	std::string_view view = source;
+	double before = timeBest(5, [&]() {
+		uint64_t sum = 0;
+		for (auto& word : words)
+		{
+			std::string token = source.substr(word.first, word.second);
+			if (keywordMap.find(token) != keywordMap.end())
+				sum += (uint64_t)keywordMap.at(token);
+			else
+				sum += (uint64_t)TokenType::Identifier;
+		}
+		benchSink = sum;
+	});
+	double after = timeBest(5, [&]() {
+		uint64_t sum = 0;
+		for (auto& word : words)
+			sum += (uint64_t)keywordType(view.substr(word.first, word.second));
+		benchSink = sum;
+	});
+
+	std::cout << count << " identifiers, " << keywordPercent << "% keywords, seed " << seed << std::endl;
+	report("unordered_map (before)", before, (double)count, "identifiers");
+	report("keywordType (after)", after, (double)count, "identifiers");
+}
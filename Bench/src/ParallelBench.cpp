@@ -0,0 +1,44 @@
+#include "Bench.h"
+
+#include "../../Pengo/src/SourceFile.h"
+#include "../../Pengo/src/tokenizer/ParallelTokenizer.h"
+
+#include <thread>
+
+// Bench parallel <file> [max threads]
+void runParallelBench(int argc, char* args[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Expected a source file to tokenize" << std::endl;
+		exit(-1);
+	}
+	SourceFile source;
+	if (!source.open(args[2]))
+	{
+		std::cout << args[2] << " does not exist!" << std::endl;
+		exit(-1);
+	}
+	int maxThreads = argc > 3 ? std::stoi(args[3]) : (int)std::thread::hardware_concurrency();
+	double megabytes = source.view().size() / (1024.0 * 1024.0);
+
+	double serial = timeBest(3, [&]() {
+		Tokenizer tokenizer(source.view());
+		benchSink = tokenizer.tokenize().size();
+	});
+	size_t tokens = benchSink;
+	std::cout << megabytes << " MB, " << tokens << " tokens" << std::endl;
+	report("serial", serial, megabytes, "MB");
+
+	for (int threads = 1; threads <= std::max(maxThreads, 1); threads++)
+	{
+		size_t chunks = 0;
+		double seconds = timeBest(3, [&]() {
+			ParallelTokenizer tokenizer(source.view(), threads);
+			chunks = tokenizer.chunkCount();
+			benchSink = tokenizer.tokens().size();
+		});
+		report(std::to_string(threads) + " threads, " + std::to_string(chunks) + " chunks", seconds, megabytes, "MB");
+		std::cout << "  " << (uint64_t)(tokens / seconds) << " tokens/s, " << serial / seconds << "x serial" << std::endl;
+	}
+}
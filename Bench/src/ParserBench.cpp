@@ -0,0 +1,108 @@
+#include "Bench.h"
+#include "Corpus.h"
+
+#include "../../Pengo/src/parser/Parser.h"
+#include "../../Pengo/src/tokenizer/Tokenizer.h"
+
+#include <vector>
+
+// What a run saw, both drivers have to agree on it
+struct ParserSteps
+{
+	uint64_t shifts = 0;
+	uint64_t reduces = 0;
+};
+
+// The loop Peg emits for the table layouts, walking the same tables through
+// action() and gotoState(). The stack is a vector here like the direct coded
+// run, so only the dispatch differs.
+static void runTables(const Parser& parser, TokenBuffer::Cursor& tokens, ParserSteps& steps)
+{
+	std::vector<int> stack;
+	stack.reserve(64);
+	stack.push_back(0);
+	while (true)
+	{
+		const Action& nextAction = parser.action(stack.back(), tokens.type());
+		if (nextAction.type == ActionType::Shift)
+		{
+			steps.shifts++;
+			tokens.advance();
+			stack.push_back(nextAction.value);
+		}
+		else if (nextAction.type == ActionType::Reduce)
+		{
+			steps.reduces++;
+			const Production& production = parser.production(nextAction.value);
+			stack.resize(stack.size() - production.rhs);
+			stack.push_back(parser.gotoState(stack.back(), production.lhs));
+		}
+		else if (nextAction.type == ActionType::Accept)
+			return;
+		else
+		{
+			std::cout << "Generated source does not parse" << std::endl;
+			exit(-1);
+		}
+	}
+}
+
+static void runParser(Parser& parser, TokenBuffer::Cursor& tokens, ParserSteps& steps)
+{
+	parser.run(tokens,
+		[&](const Token&) { steps.shifts++; },
+		[&](const Production&, int) { steps.reduces++; });
+}
+
+// Bench parser [shape|all] [megabytes] [seed]
+void runParserBench(int argc, char* args[])
+{
+	std::string shapeName = argc > 2 ? args[2] : "all";
+	double megabytes = argc > 3 ? std::stod(args[3]) : 8.0;
+	unsigned seed = argc > 4 ? (unsigned)std::stoul(args[4]) : 1;
+
+	std::vector<CorpusShape> shapes;
+	CorpusShape shape;
+	if (shapeName == "all")
+		shapes = { CorpusShape::Identifiers, CorpusShape::Strings, CorpusShape::Comments, CorpusShape::Nested, CorpusShape::Mixed, CorpusShape::Unicode };
+	else if (corpusShapeFromName(shapeName, shape))
+		shapes = { shape };
+	else
+	{
+		std::cout << "Unknown corpus shape " << shapeName << std::endl;
+		exit(-1);
+	}
+
+	std::cout << megabytes << " MB per shape, seed " << seed << std::endl;
+	Parser parser;
+	for (CorpusShape shape : shapes)
+	{
+		std::string source = generateCorpus(shape, (size_t)(megabytes * 1024 * 1024), seed);
+		LineIndex::script().reset(source);
+		Tokenizer tokenizer(source);
+		TokenBuffer tokens = tokenizer.tokenize();
+
+		// Both drivers take the same tokens from the same buffer
+		ParserSteps tableSteps, parserSteps;
+		double tableSeconds = timeBest(5, [&]() {
+			TokenBuffer::Cursor cursor = tokens.cursor();
+			tableSteps = {};
+			runTables(parser, cursor, tableSteps);
+		});
+		double parserSeconds = timeBest(5, [&]() {
+			TokenBuffer::Cursor cursor = tokens.cursor();
+			parserSteps = {};
+			runParser(parser, cursor, parserSteps);
+		});
+		if (tableSteps.shifts != parserSteps.shifts || tableSteps.reduces != parserSteps.reduces)
+		{
+			std::cout << "Table and generated parsers disagree on " << corpusShapeName(shape) << std::endl;
+			exit(-1);
+		}
+		benchSink = parserSteps.shifts + parserSteps.reduces;
+
+		std::cout << corpusShapeName(shape) << ", " << tokens.size() << " tokens, " << parserSteps.reduces << " reductions" << std::endl;
+		report("  tables", tableSeconds, (double)tokens.size(), "tokens");
+		report("  generated", parserSeconds, (double)tokens.size(), "tokens");
+	}
+}
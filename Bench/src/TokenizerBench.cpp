@@ -0,0 +1,98 @@
+#include "Bench.h"
+#include "Corpus.h"
+
+#include "../../Pengo/src/tokenizer/Tokenizer.h"
+
+#include <vector>
+
+struct TokenizerResult
+{
+	CorpusShape shape;
+	size_t bytes;
+	size_t tokens;
+	double seconds;
+};
+
+static void printJson(const std::vector<TokenizerResult>& results, unsigned seed)
+{
+	std::cout << "{\"benchmark\": \"tokenizer\", \"seed\": " << seed << ", \"results\": [";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const TokenizerResult& result = results[i];
+		std::cout << (i ? ", " : "") << std::endl << "  {\"shape\": \"" << corpusShapeName(result.shape) << "\""
+			<< ", \"bytes\": " << result.bytes
+			<< ", \"tokens\": " << result.tokens
+			<< ", \"seconds\": " << result.seconds
+			<< ", \"mb_per_second\": " << result.bytes / (1024.0 * 1024.0) / result.seconds
+			<< ", \"tokens_per_second\": " << result.tokens / result.seconds << "}";
+	}
+	std::cout << std::endl << "]}" << std::endl;
+}
+
+// Bench tokenizer [shape|all] [megabytes] [seed] [-json]
+void runTokenizerBench(int argc, char* args[])
+{
+	std::vector<std::string> options;
+	bool json = false;
+	for (int i = 2; i < argc; i++)
+	{
+		if (std::string(args[i]) == "-json")
+			json = true;
+		else
+			options.push_back(args[i]);
+	}
+	std::string shapeName = options.size() > 0 ? options[0] : "all";
+	double megabytes = options.size() > 1 ? std::stod(options[1]) : 8.0;
+	unsigned seed = options.size() > 2 ? (unsigned)std::stoul(options[2]) : 1;
+
+	std::vector<CorpusShape> shapes;
+	CorpusShape shape;
+	if (shapeName == "all")
+		shapes = { CorpusShape::Identifiers, CorpusShape::Strings, CorpusShape::Comments, CorpusShape::Nested, CorpusShape::Mixed, CorpusShape::Unicode };
+	else if (corpusShapeFromName(shapeName, shape))
+		shapes = { shape };
+	else
+	{
+		std::cout << "Unknown corpus shape " << shapeName << std::endl;
+		exit(-1);
+	}
+
+	std::vector<TokenizerResult> results;
+	for (CorpusShape shape : shapes)
+	{
+		std::string source = generateCorpus(shape, (size_t)(megabytes * 1024 * 1024), seed);
+		size_t tokens = 0;
+		double seconds = timeBest(5, [&]() {
+			Tokenizer tokenizer(source);
+			tokens = tokenizer.tokenize().size();
+			benchSink = tokens;
+		});
+		results.push_back({ shape, source.size(), tokens, seconds });
+	}
+
+	if (json)
+	{
+		printJson(results, seed);
+		return;
+	}
+	std::cout << megabytes << " MB per shape, seed " << seed << std::endl;
+	for (const TokenizerResult& result : results)
+	{
+		report(corpusShapeName(result.shape), result.seconds, result.bytes / (1024.0 * 1024.0), "MB");
+		std::cout << "  " << (uint64_t)(result.tokens / result.seconds) << " tokens/s, " << result.tokens << " tokens" << std::endl;
+	}
+}
+
+// Bench corpus <shape> [megabytes] [seed], writes the source to stdout
+void runCorpus(int argc, char* args[])
+{
+	CorpusShape shape;
+	if (argc < 3 || !corpusShapeFromName(args[2], shape))
+	{
+		std::cout << "Expected a corpus shape: identifiers, strings, comments, nested, mixed or unicode" << std::endl;
+		exit(-1);
+	}
+	double megabytes = argc > 3 ? std::stod(args[3]) : 8.0;
+	unsigned seed = argc > 4 ? (unsigned)std::stoul(args[4]) : 1;
+	std::cout << generateCorpus(shape, (size_t)(megabytes * 1024 * 1024), seed);
+}
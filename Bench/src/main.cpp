@@ -0,0 +1,28 @@
+#include "Bench.h"
+
+#include <string>
+
+int main(int argc, char* args[])
+{
+	std::string bench = argc > 1 ? args[1] : "";
+	if (bench == "keywords")
+		runKeywordBench(argc, args);
+	else if (bench == "parallel")
+		runParallelBench(argc, args);
+	else if (bench == "tokenizer")
+		runTokenizerBench(argc, args);
+	else if (bench == "parser")
+		runParserBench(argc, args);
+	else if (bench == "corpus")
+		runCorpus(argc, args);
+	else
+	{
+		std::cout << "Usage: Bench <benchmark> [options]" << std::endl;
+		std::cout << "  keywords [identifiers] [keyword percent] [seed]" << std::endl;
+		std::cout << "  parallel <file> [max threads]" << std::endl;
+		std::cout << "  tokenizer [identifiers|strings|comments|nested|mixed|unicode|all] [megabytes] [seed] [-json]" << std::endl;
+		std::cout << "  parser [identifiers|strings|comments|nested|mixed|unicode|all] [megabytes] [seed]" << std::endl;
+		std::cout << "  corpus <shape> [megabytes] [seed]" << std::endl;
+		return -1;
+	}
+}
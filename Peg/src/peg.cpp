@@ -5,10 +5,14 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <set>
+#include <map>
+#include <algorithm>
 #include <queue>
 #include <stack>
 #include <iostream>
 #include <fstream>
+#include <cstdint>
+#include <climits>
 
 enum class SymbolType
 {
@@ -45,6 +49,12 @@ struct Production
 {
 	Symbol lhs;
 	std::vector<Symbol> rhs;
+	// C++ expression building the lhs value on reduce, $1 to $n are the rhs values.
+	// Without one the rule passes its first value on
+	std::string action = "";
+	// Terminal whose precedence the rule takes, like yacc's %prec. Without one it
+	// is the last terminal of the rhs
+	std::string precedence = "";
 
 	bool operator== (const Production& other) const
 	{
@@ -54,69 +64,89 @@ struct Production
 	}
 };
 
-struct TrackedProduction
+// A dense set of terminals, bit i stands for Peg's i'th terminal
+struct TerminalSet
 {
-	Production production;
-	int pointer = 0;
-	std::unordered_set<Symbol> lookAhead;
+	std::vector<uint64_t> words;
 
-	bool isAtEnd() const
+	void insert(int terminal)
 	{
-		return pointer >= (int)production.rhs.size();
+		if (terminal / 64 >= (int)words.size())
+			words.resize(terminal / 64 + 1, 0);
+		words[terminal / 64] |= (uint64_t)1 << (terminal % 64);
 	}
 
-	const Symbol nextSymbol() const
+	bool contains(int terminal) const
 	{
-		if (pointer + 1 == production.rhs.size())
-			return { "$" };
-		return production.rhs[pointer + 1];
+		return terminal / 64 < (int)words.size() && (words[terminal / 64] >> (terminal % 64) & 1);
 	}
 
-	bool operator== (const TrackedProduction& other) const
+	bool empty() const
 	{
-		return production == other.production &&
-			pointer == other.pointer &&
-			std::equal(lookAhead.begin(), lookAhead.end(), other.lookAhead.begin());
+		for (uint64_t word : words)
+			if (word)
+				return false;
+		return true;
 	}
+
+	void unite(const TerminalSet& other)
+	{
+		if (other.words.size() > words.size())
+			words.resize(other.words.size(), 0);
+		for (int i = 0; i < (int)other.words.size(); i++)
+			words[i] |= other.words[i];
+	}
+};
+
+// An item of an item set. The production is an index into Peg's interned
+// productions
+struct TrackedProduction
+{
+	int production = 0;
+	int pointer = 0;
+	TerminalSet lookAhead;
 };
 
 struct ItemSet
 {
 	int setNumber = -1;
+	// The kernel comes first, sorted by production and pointer, then its closure
 	std::vector<TrackedProduction> productions;
-	std::unordered_map<Symbol, int> next;
+	// Set each symbol after a pointer leads to
+	std::map<int, int> next;
+};
 
-	void print()
-	{
-		std::cout << "I" << setNumber << std::endl;
-		for (TrackedProduction& tProd : productions)
-		{
-			Production& prod = tProd.production;
-			std::cout << prod.lhs.symbol << " -> ";
-			for (int i = 0; i < (int)prod.rhs.size(); i++)
-			{
-				if (tProd.pointer == i)
-					std::cout << "%";
-				std::cout << prod.rhs[i].symbol;
-			}
-			if (tProd.pointer == prod.rhs.size())
-				std::cout << "%";
-			if (tProd.lookAhead.size() == 0)
-			{
-				std::cout << " {}" << std::endl;
-				continue;
-			}
-			std::cout << " { ";
-			for (Symbol symbol : tProd.lookAhead)
-			{
-				std::cout << symbol.symbol << " ";
-			}
-			std::cout << "}" << std::endl;
+// A production with its symbols interned
+struct InternedProduction
+{
+	int lhs;
+	std::vector<int> rhs;
+};
 
-		}
+// Hashes a kernel flattened to production and pointer pairs
+struct KernelHash
+{
+	size_t operator()(const std::vector<int>& kernel) const
+	{
+		size_t hash = kernel.size();
+		for (int value : kernel)
+			hash ^= (size_t)value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		return hash;
 	}
 };
 
+enum class Associativity
+{
+	Left, Right, NonAssoc
+};
+
+struct Precedence
+{
+	// 0 for none, higher binds tighter
+	int level = 0;
+	Associativity associativity = Associativity::Left;
+};
+
 class Grammar
 {
 public:
@@ -127,13 +157,49 @@ public:
 		m_productions.push_back(production);
 	}
 
+	// Like yacc's %left, %right and %nonassoc lines, each call binds tighter than the ones before it
+	void addPrecedence(Associativity associativity, const std::vector<std::string>& terminals)
+	{
+		m_precedenceLevels++;
+		for (const std::string& terminal : terminals)
+			m_precedence[terminal] = { m_precedenceLevels, associativity };
+	}
+
+	Precedence getPrecedence(const std::string& terminal) const
+	{
+		auto precedence = m_precedence.find(terminal);
+		return precedence != m_precedence.end() ? precedence->second : Precedence();
+	}
+
+	Precedence getPrecedence(const Production& production) const
+	{
+		if (!production.precedence.empty())
+			return getPrecedence(production.precedence);
+		for (auto symbol = production.rhs.rbegin(); symbol != production.rhs.rend(); symbol++)
+			if (symbol->type == SymbolType::TERMINAL)
+				return getPrecedence(symbol->symbol);
+		return Precedence();
+	}
+
 	const Symbol& getStart() const { return m_start; }
 	const std::vector<Production>& getProductions() const { return m_productions; }
 private:
 	const Symbol m_start;
 	std::vector<Production> m_productions;
+	std::unordered_map<std::string, Precedence> m_precedence;
+	int m_precedenceLevels = 0;
+};
+
+enum class TableLayout
+{
+	Dense, // One row per state with a column for every token or node type
+	Comb,  // The rows overlapped into one vector with a check array, for big grammars
+	Direct // Dense tables for the lookups, but run() is coded as a block per state
 };
 
+// Bump when the layout of the table files changes, Parsers only load their own version
+#define TABLES_VERSION 1
+
 class Peg
 {
 public:
@@ -144,17 +210,24 @@ public:
 		m_typeSubstitution[symbol] = tokenType;
 	}
 
+	// Generates Parser::build, which runs the productions' actions as they are
+	// reduced. The header has to define valueType and whatever the actions call.
+	void setSemanticActions(std::string header, std::string valueType)
+	{
+		m_actionHeader = header;
+		m_valueType = valueType;
+	}
+
 	void generateTables()
 	{
-		Grammar augmentedGrammar = m_grammar;
 		Symbol augmentedStart = { std::string(m_grammar.getStart().symbol) + "'", SymbolType::NONTERMINAL, false };
-		m_augmentedProduction = { augmentedStart, {m_grammar.getStart()} };
-		augmentedGrammar.addProduction(m_augmentedProduction);
+		internGrammar({ augmentedStart, {m_grammar.getStart()} });
 
-		TrackedProduction startTrackedProduction = { m_augmentedProduction, 0, { {"$" }} };
+		TrackedProduction startTrackedProduction = { m_augmentedProduction, 0, {} };
 
 		// Start generating all the item sets and its closures
 		m_itemSets.push_back(createItemSet({ startTrackedProduction }));
+		m_kernels[{ m_augmentedProduction, 0 }] = 0;
 		m_setBus.push(0);
 		while (!m_setBus.empty())
 		{
@@ -162,29 +235,23 @@ public:
 			m_setBus.pop();
 		}
 
-		// Generate all the look ahead tokens for the item sents
-		m_lookAheadBus.push(std::make_pair(0, std::vector<TrackedProduction>{ startTrackedProduction }));
-		while (!m_lookAheadBus.empty())
-		{
-			generateLookAheads(m_itemSets[m_lookAheadBus.front().first], m_lookAheadBus.front().second);
-			m_lookAheadBus.pop();
-		}
-		for (ItemSet& set : m_itemSets)
-			deriveLookAheads(set);
+		// Generate all the look ahead tokens for the item sets
+		generateLookAheads();
 
 		// Create reductions actions and accept actions where applicable
 		defineActions();
+		defineDefaultReductions();
 		generateTypes();
 
 		for (ItemSet& set : m_itemSets)
 		{
-			set.print();
+			printItemSet(set);
 			std::cout << std::endl;
 		}
 		addSubstitution("$", "_EOF");
 	}
 
-	void generateParser(std::string fileLocation)
+	void generateParser(std::string fileLocation, TableLayout layout = TableLayout::Dense)
 	{
 		std::string headerFileName = fileLocation + "Parser.h";
 		std::string sourceFileName = fileLocation + "Parser.h";
@@ -192,19 +259,36 @@ public:
 		headerFile.open(headerFileName, std::fstream::out);
 		sourceFile.open(sourceFileName, std::fstream::out);
 
+		// Packed either way for the report
+		std::vector<std::string> terminals = terminalNames();
+		CombTable actionComb = packRows(actionRows(terminals), (int)terminals.size() + 1, "{}");
+		CombTable gotoComb = packRows(gotoRows(), (int)m_expressions.size(), "0");
+
 		if (headerFile.is_open())
 		{
 			std::string contents =
 				"#pragma once\n"
 				"#include \"../tokenizer/Token.h\"\n"
+				"#include \"../tokenizer/LineIndex.h\"\n"
+				"#include <array>\n"
+				"#include <cstdint>\n"
+				"#include <span>\n"
 				"#include <vector>\n"
 				"#include <stack>\n"
 				"#include <queue>\n"
-				"#include <unordered_map>\n"
 				"#include <iostream>\n"
-				"#include <algorithm>\n";
+				"#include <algorithm>\n"
+				"#include <cstring>\n"
+				"#include <memory>\n"
+				"#include \"../SourceFile.h\"\n";
+			if (!m_valueType.empty())
+				contents.append("#include \"").append(m_actionHeader).append("\"\n");
 			contents.append("#define SET_NUM ").append(std::to_string(m_itemSets.size())).append("\n");
 			contents.append("#define GRAMMAR_NUM ").append(std::to_string(m_grammar.getProductions().size())).append("\n");
+			contents.append("#define NODE_NUM ").append(std::to_string(m_expressions.size())).append("\n");
+			contents.append("// _EOF is the last token type\n");
+			contents.append("#define TOKEN_NUM ((int)TokenType::_EOF + 1)\n");
+			contents.append("#define TABLES_VERSION ").append(std::to_string(TABLES_VERSION)).append("\n");
 
 			contents.append(
 				"enum class NodeType\n"
@@ -220,8 +304,9 @@ public:
 				"{\n"
 				"	NodeType type;\n"
 				"	bool terminal = false;\n"
-				"	Token token;\n"
-				"	std::vector<Node> children;\n"
+				"	// Terminals index the tree's tokens, the rest their first child in its nodes\n"
+				"	uint32_t index = 0;\n"
+				"	uint32_t count = 0;\n"
 				"};\n"
 				"enum class ActionType\n"
 				"{\n"
@@ -241,167 +326,1110 @@ public:
 				"	int rhs = 0;\n"
 				"	int rhsNodes = 0;\n"
 				"	bool terminates = false;\n"
+				"	// A unit rule without an action, its node or value is just its child's\n"
+				"	bool passThrough = false;\n"
+				"};\n"
+				"// Start of a table file Peg writes with -tables. The token and node names follow,\n"
+				"// NUL terminated and padded to 4 bytes, then the rules as { lhs, rhs, rhsNodes,\n"
+				"// flags } and the dense layout's default actions, reduce only flags (padded),\n"
+				"// action table and goto table. Columns are in the order of the names.\n"
+				"struct TablesHeader\n"
+				"{\n"
+				"	char magic[4];\n"
+				"	uint32_t version;\n"
+				"	uint32_t states, tokens, nodes, rules;\n"
+				"	uint32_t namesSize;\n"
+				"};\n"
+				"// Nodes are bump allocated as the rules are reduced, each reduction appends its\n"
+				"// children in order so they sit next to each other. The root is always last.\n"
+				"struct ParseTree\n"
+				"{\n"
+				"	std::vector<Node> nodes;\n"
+				"	std::vector<Token> tokens;\n"
+				"\n"
+				"	inline const Node& root() const { return nodes.back(); }\n"
+				"	inline std::span<const Node> children(const Node& node) const { return { nodes.data() + node.index, node.count }; }\n"
+				"	inline const Token& token(const Node& node) const { return tokens[node.index]; }\n"
+				"\n"
+				"	// Turns the top of the output stack into the node a rule reduces to\n"
+				"	inline void reduce(std::vector<Node>& output, const Production& production, const Token& lastToken)\n"
+				"	{\n"
+				"		if (production.passThrough)\n"
+				"			return;\n"
+				"		Node node;\n"
+				"		node.type = production.lhs;\n"
+				"		node.terminal = production.terminates;\n"
+				"		if (production.terminates)\n"
+				"		{\n"
+				"			node.index = (uint32_t)tokens.size();\n"
+				"			tokens.push_back(lastToken);\n"
+				"		}\n"
+				"		else\n"
+				"		{\n"
+				"			node.index = (uint32_t)nodes.size();\n"
+				"			node.count = production.rhsNodes;\n"
+				"			nodes.insert(nodes.end(), output.end() - production.rhsNodes, output.end());\n"
+				"			output.resize(output.size() - production.rhsNodes);\n"
+				"		}\n"
+				"		output.push_back(node);\n"
+				"	}\n"
+				"};\n"
+				"// The parser reads the current token's type and only builds the Token when it\n"
+				"// shifts one. A TokenBuffer::Cursor reads its type array like that, streams\n"
+				"// with a Token next() such as the Tokenizer are pulled through this instead\n"
+				"template<typename TokenStream>\n"
+				"class PulledTokens\n"
+				"{\n"
+				"public:\n"
+				"	PulledTokens(TokenStream& stream) : m_stream(stream), m_current(stream.next()) { }\n"
+				"\n"
+				"	inline TokenType type() const { return m_current.type; }\n"
+				"	inline const Token& token() const { return m_current; }\n"
+				"	inline void advance() { m_current = m_stream.next(); }\n"
+				"private:\n"
+				"	TokenStream& m_stream;\n"
+				"	Token m_current;\n"
 				"};\n"
 				"class Parser\n"
 				"{\n"
 				"public:\n"
-				"	Parser()\n"
+			);
+			contents.append(
+				"	// Takes a TokenBuffer::Cursor or anything with a Token next(), e.g. the Tokenizer\n"
+				"	template<typename TokenStream>\n"
+				"	ParseTree parse(TokenStream& tokens)\n"
 				"	{\n"
+				"		ParseTree tree;\n"
+				"		std::vector<Node> output;\n"
+				"		// Rules that terminate take the token shifted last\n"
+				"		Token lastToken;\n"
+				"		run(tokens,\n"
+				"			[&](const Token& token) { lastToken = token; },\n"
+				"			[&](const Production& production, int)\n"
+				"			{\n"
+				"				// Only loaded tables can ask for nodes that were never made\n"
+				"				if (output.size() < (size_t)production.rhsNodes)\n"
+				"					corruptTables();\n"
+				"				tree.reduce(output, production, lastToken);\n"
+				"			});\n"
+				"		if (output.empty())\n"
+				"			corruptTables();\n"
+				"		tree.nodes.push_back(output.back());\n"
+				"		return tree;\n"
+				"	}\n"
+				"\n"
 			);
-			for (auto statePair : m_action)
+			if (!m_valueType.empty())
+				contents.append(
+					"	// Runs the grammar's actions as the rules are reduced, no tree is built\n"
+					"	template<typename TokenStream>\n"
+					"	" + m_valueType + " build(TokenStream& tokens)\n"
+					"	{\n"
+					"		std::vector<" + m_valueType + "> values;\n"
+					"		run(tokens,\n"
+					"			[&](const Token& token) { values.push_back(token); },\n"
+					"			[&](const Production& production, int rule)\n"
+					"			{\n"
+					"				if (production.passThrough)\n"
+					"					return;\n"
+					"				" + m_valueType + " value = reduceAction(rule, values.data() + values.size() - production.rhs);\n"
+					"				values.resize(values.size() - production.rhs);\n"
+					"				values.push_back(std::move(value));\n"
+					"			});\n"
+					"		return std::move(values.back());\n"
+					"	}\n"
+					"\n"
+				);
+			generateTableLoading(contents);
+			if (layout == TableLayout::Comb)
+				generateCombTables(contents, actionComb, gotoComb);
+			else
+				generateDenseTables(contents);
+			generateLoadedTables(contents, terminals);
+			if (layout == TableLayout::Direct)
 			{
-				int num = statePair.first;
-				for (auto tokenPair : m_action[num])
-				{
-					std::string token = getSymbolName(tokenPair.first);
-					char actionType = tokenPair.second[0];
-					std::string action;
-					switch (actionType)
-					{
-					case 'A':
-						action = "{ ActionType::Accept }; ";
-						break;
-					case 'S':
-						action = std::string("{ ActionType::Shift, ").append(tokenPair.second.substr(1)).append(" }");
-						break;
-					case 'R':
-						action = std::string("{ ActionType::Reduce, ").append(tokenPair.second.substr(1)).append(" }");
-						break;
-					}
-					contents.append("		m_actionTable[").append(std::to_string(num)).append("][TokenType::").append(token).append("] = ").append(action).append(";\n");
-				}
+				contents.append("\n	// Loaded tables have no code, they are walked like the other layouts do\n");
+				contents.append(tableRun("driveTables"));
+				generateDirectRun(contents);
 			}
-			for (auto statePair : m_goto)
+			else
+				contents.append("\n").append(tableRun("drive"));
+			generateRunEntry(contents);
+			if (!m_valueType.empty())
+				generateSemanticActions(contents);
+			contents.append("};\n");
+
+			headerFile << contents.c_str();
+		}
+
+		headerFile.close();
+		sourceFile.close();
+		reportTables(layout, actionComb, gotoComb);
+	}
+
+	// Writes the tables to a file Parser::loadTables can map, Parser.h is left alone.
+	// Everything is 4 byte little endian words, see TablesHeader in Parser.h
+	void writeTables(std::string fileName)
+	{
+		std::ofstream file(fileName, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::cout << "Could not write " << fileName << std::endl;
+			exit(-1);
+		}
+		auto put = [&](int32_t value) { file.write((const char*)&value, sizeof(value)); };
+		auto putAction = [&](const std::string& action) {
+			switch (action.empty() ? ' ' : action[0])
 			{
-				int num = statePair.first;
-				for (auto gotoPair : m_goto[num])
-				{
-					std::string token = getSymbolName(gotoPair.first);
-					contents.append("		m_gotoTable[").append(std::to_string(num)).append("][NodeType::").append(token).append("] = ").append(std::to_string(gotoPair.second)).append(";\n");
-				}
+			case 'S': put(1); put(std::stoi(action.substr(1))); break;
+			case 'R': put(2); put(std::stoi(action.substr(1))); break;
+			case 'A': put(3); put(-1); break;
+			default: put(0); put(-1); break;
 			}
-			for (int i = 0; i < (int)m_grammar.getProductions().size(); i++)
+		};
+
+		std::vector<std::string> terminals = terminalNames();
+		std::vector<std::string> nodes(m_expressions.begin(), m_expressions.end());
+		std::string names;
+		for (const std::string& name : terminals)
+			names.append(name).push_back('\0');
+		for (const std::string& name : nodes)
+			names.append(name).push_back('\0');
+		names.resize((names.size() + 3) / 4 * 4, '\0');
+
+		file.write("PEGT", 4);
+		put(TABLES_VERSION);
+		put((int32_t)m_itemSets.size());
+		put((int32_t)terminals.size());
+		put((int32_t)nodes.size());
+		put((int32_t)m_grammar.getProductions().size());
+		put((int32_t)names.size());
+		file.write(names.data(), names.size());
+
+		for (const Production& production : m_grammar.getProductions())
+		{
+			int nonTerminals = 0;
+			for (const Symbol& symbol : production.rhs)
+				nonTerminals += symbol.type == SymbolType::NONTERMINAL;
+			put((int32_t)(std::find(nodes.begin(), nodes.end(), production.lhs.symbol) - nodes.begin()));
+			put((int32_t)production.rhs.size());
+			put(nonTerminals);
+			put((nonTerminals == 0 ? 1 : 0) | (isPassThrough(production) ? 2 : 0));
+		}
+		for (int rule : m_defaultReductions)
+			putAction(rule == 0 ? "" : "R" + std::to_string(rule));
+		std::string reducesOnly;
+		for (bool only : m_reducesOnly)
+			reducesOnly.push_back(only ? 1 : 0);
+		reducesOnly.resize((reducesOnly.size() + 3) / 4 * 4, 0);
+		file.write(reducesOnly.data(), reducesOnly.size());
+
+		for (int num = 0; num < (int)m_itemSets.size(); num++)
+			for (const std::string& terminal : terminals)
 			{
-				Production p = m_grammar.getProductions()[i];
-				bool terminates = true;
-				int nonTerminals = 0;
-				for (const Symbol& symbol : p.rhs)
-					if (symbol.type == SymbolType::NONTERMINAL)
-					{
-						terminates = false;
-						nonTerminals++;
-					}
-				// mak eif you add a new token to a set and it adds onto the set it removes the links if it was changed because the new lookaheads were new
-				contents.append("		m_grammar[").append(std::to_string(i)).append("] = { NodeType::").append(p.lhs.symbol).
-					append(", ").append(std::to_string(p.rhs.size())).append(", ").
-					append(std::to_string(nonTerminals)).append(", ").
-					append(terminates ? "true" : "false").append(" };\n");
+				std::string action;
+				for (auto& tokenPair : m_action[num])
+					if (getSymbolName(tokenPair.first) == terminal)
+						action = tokenPair.second;
+				putAction(action);
+			}
+		for (int num = 0; num < (int)m_itemSets.size(); num++)
+			for (const std::string& node : nodes)
+			{
+				auto gotoPair = m_goto[num].find(node);
+				put(gotoPair != m_goto[num].end() ? gotoPair->second : 0);
 			}
-			contents.append(
-				"	}\n"
 
-				"	Node parse(std::vector<Token> tokens)\n"
+		std::cout << "Wrote " << fileName << ", " << file.tellp() << " bytes" << std::endl;
+	}
+private:
+	std::string tableRun(const std::string& name)
+	{
+		return
+				"	template<typename TokenReader, typename OnShift, typename OnReduce>\n"
+				"	void " + name + "(TokenReader& tokens, OnShift onShift, OnReduce onReduce)\n"
 				"	{\n"
-				"		std::queue<Token, std::deque<Token>> input(std::deque<Token>(tokens.begin(), tokens.end()));\n"
 				"		std::stack<int> stack;\n"
 				"		stack.push(0);\n"
-				"		std::stack<Node> output;\n"
-				"		Token beforeToken = input.front();\n"
 				"		int state = 0;\n"
+				"		// A correct parser only reduces so many times between two shifts, loaded\n"
+				"		// tables that reduce in a loop are stopped before the stack grows without end\n"
+				"		const size_t rules = m_tables ? m_tables->grammar.size() : GRAMMAR_NUM;\n"
+				"		size_t reductions = 0, shiftedDepth = 1;\n"
 				"		while (true)\n"
 				"		{\n"
 				"			state = stack.top();\n"
-				"			Token& current = input.front();\n"
-				"			Action& nextAction = m_actionTable[state][current.type];\n"
+				"			const Action& nextAction = action(state, tokens.type());\n"
 				"			if (nextAction.type == ActionType::None)\n"
 				"			{\n"
-				"				if (current.type == TokenType::_EOF)\n"
-				"					std::cout << \"Unexpected end of file at line \" << current.line << \" at pos \" << current.pos << std::endl;\n"
+				"				LineIndex::Location at = LineIndex::script().locate(tokens.token().offset);\n"
+				"				if (tokens.type() == TokenType::_EOF)\n"
+				"					std::cout << \"Unexpected end of file at line \" << at.line << \" at pos \" << at.pos << std::endl;\n"
 				"				else\n"
-				"					std::cout << \"Error parsing line \" << current.line << \" at pos \" << current.pos << std::endl;\n"
+				"					std::cout << \"Error parsing line \" << at.line << \" at pos \" << at.pos << std::endl;\n"
 				"				exit(-2);\n"
 				"			}\n"
 				"			else if (nextAction.type == ActionType::Shift)\n"
 				"			{\n"
-				"				beforeToken = input.front();\n"
-				"				input.pop();\n"
+				"				onShift(tokens.token());\n"
+				"				tokens.advance();\n"
 				"				stack.push(nextAction.value);\n"
+				"				reductions = 0;\n"
+				"				shiftedDepth = stack.size();\n"
 				"			}\n"
 				"			else if (nextAction.type == ActionType::Reduce)\n"
 				"			{\n"
 				"				// Push the rule to the stack\n"
-				"				Production production = m_grammar[nextAction.value - 1];\n"
-				"				for (int i = 0; i < production.rhs; i++)\n"
+				"				const Production& rule = production(nextAction.value);\n"
+				"				if (rule.rhs >= (int)stack.size() || ++reductions > (shiftedDepth + 1) * rules)\n"
+				"					corruptTables();\n"
+				"				for (int i = 0; i < rule.rhs; i++)\n"
 				"					stack.pop();\n"
-				"				stack.push(m_gotoTable[stack.top()][production.lhs]);\n"
-				"				Node node;\n"
-				"				node.terminal = production.terminates;\n"
-				"				node.type = production.lhs;\n"
-				"				if (production.terminates)\n"
-				"					node.token = beforeToken;\n"
-				"				else\n"
-				"				{\n"
-				"					for (int i = 0; i < production.rhsNodes; i++)\n"
-				"					{\n"
-				"						node.children.push_back(output.top());\n"
-				"						output.pop();\n"
-				"					}\n"
-				"				}\n"
-				"				output.push(node);\n"
+				"				stack.push(gotoState(stack.top(), rule.lhs));\n"
+				"				onReduce(rule, nextAction.value);\n"
 				"			}\n"
 				"			else if (nextAction.type == ActionType::Accept)\n"
 				"			{\n"
 				"				break;\n"
 				"			}\n"
 				"		}\n"
-				"		Node root = output.top();\n"
-				"		std::stack<Node*> toReverse({ &root });\n"
-				"		while (!toReverse.empty())\n"
-				"		{\n"
-				"			Node* node = toReverse.top();\n"
-				"			toReverse.pop();\n"
-				"			for (Node& child : node->children)\n"
-				"				toReverse.push(&child);\n"
-				"			std::reverse(node->children.begin(), node->children.end());\n"
-				"		}\n"
-				"		return root;\n"
-				"	}\n"
-				"private:\n"
-				"	Production m_grammar[GRAMMAR_NUM];\n"
-				"	std::unordered_map<TokenType, Action> m_actionTable[SET_NUM];\n"
-				"	std::unordered_map<NodeType, int> m_gotoTable[SET_NUM];\n"
-				"};\n"
-			);
-
-			headerFile << contents.c_str();
-		}
-
-		headerFile.close();
-		sourceFile.close();
+				"	}\n";
 	}
-private:
+
 	const Grammar m_grammar;
-	Production m_augmentedProduction;
+	// The item sets are built on ids, symbols are numbered in the order they first
+	// come up in the grammar and productions keep their index
+	std::vector<Symbol> m_symbols;
+	std::map<std::pair<std::string, SymbolType>, int> m_symbolIds;
+	// The grammar's productions with the augmented production last
+	std::vector<InternedProduction> m_productions;
+	std::vector<std::vector<int>> m_productionsOf;
+	// The productions whose start items a nonterminal after a pointer brings into a set
+	std::vector<std::vector<int>> m_closures;
+	std::vector<bool> m_nullable;
+	// Look aheads are sets of terminal indices, symbol id of each terminal and back
+	std::vector<int> m_terminals, m_terminalIndex;
+	int m_augmentedProduction = 0, m_endSymbol = 0;
 	std::vector<ItemSet> m_itemSets;
+	// Item set by kernel, so an existing set is found without comparing it to the rest
+	std::unordered_map<std::vector<int>, int, KernelHash> m_kernels;
 	std::unordered_map<int, std::unordered_map<std::string, std::string>> m_action;
 	std::unordered_map<int, std::unordered_map<std::string, int>> m_goto;
+	// Rule a state reduces by when the token has no entry, 0 for none. When it
+	// is all the state does the parser reduces without looking at the token
+	std::vector<int> m_defaultReductions;
+	std::vector<bool> m_reducesOnly;
+	int m_resolvedConflicts = 0, m_unresolvedConflicts = 0;
 	std::unordered_set<std::string> m_expressions;
 	std::unordered_set<std::string> m_tokens;
 	std::unordered_map<std::string, std::string> m_typeSubstitution;
+	std::string m_actionHeader, m_valueType;
 	std::queue<int> m_setBus;
 
-	ItemSet createItemSet(std::vector<TrackedProduction> productions)
+	int internSymbol(const Symbol& symbol)
+	{
+		auto id = m_symbolIds.find({ symbol.symbol, symbol.type });
+		if (id != m_symbolIds.end())
+			return id->second;
+		m_symbols.push_back(symbol);
+		m_symbolIds[{ symbol.symbol, symbol.type }] = (int)m_symbols.size() - 1;
+		return (int)m_symbols.size() - 1;
+	}
+
+	// Numbers the symbols and productions and works out each nonterminal's closure
+	// once, every item set with that nonterminal after a pointer gets the same one.
+	// Also finds the nullable nonterminals for the look aheads
+	void internGrammar(const Production& augmentedProduction)
+	{
+		m_endSymbol = internSymbol({ "$" });
+		std::vector<Production> productions = m_grammar.getProductions();
+		productions.push_back(augmentedProduction);
+		for (const Production& production : productions)
+		{
+			InternedProduction interned = { internSymbol(production.lhs), {} };
+			for (const Symbol& symbol : production.rhs)
+				interned.rhs.push_back(internSymbol(symbol));
+			m_productions.push_back(interned);
+		}
+		m_augmentedProduction = (int)m_productions.size() - 1;
+
+		m_productionsOf.assign(m_symbols.size(), {});
+		for (int i = 0; i < (int)m_productions.size(); i++)
+			m_productionsOf[m_productions[i].lhs].push_back(i);
+
+		m_terminalIndex.assign(m_symbols.size(), -1);
+		for (int symbol = 0; symbol < (int)m_symbols.size(); symbol++)
+		{
+			if (m_symbols[symbol].type != SymbolType::TERMINAL)
+				continue;
+			m_terminalIndex[symbol] = (int)m_terminals.size();
+			m_terminals.push_back(symbol);
+		}
+
+		m_nullable.assign(m_symbols.size(), false);
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (const InternedProduction& production : m_productions)
+			{
+				if (m_nullable[production.lhs])
+					continue;
+				bool nullable = true;
+				for (int symbol : production.rhs)
+					nullable = nullable && m_nullable[symbol];
+				if (nullable)
+					m_nullable[production.lhs] = changed = true;
+			}
+		}
+
+		m_closures.assign(m_symbols.size(), {});
+		for (int symbol = 0; symbol < (int)m_symbols.size(); symbol++)
+		{
+			if (m_symbols[symbol].type != SymbolType::NONTERMINAL)
+				continue;
+			std::vector<bool> seen(m_symbols.size(), false);
+			std::vector<int> stack = { symbol };
+			seen[symbol] = true;
+			while (!stack.empty())
+			{
+				int next = stack.back();
+				stack.pop_back();
+				for (int production : m_productionsOf[next])
+				{
+					m_closures[symbol].push_back(production);
+					const std::vector<int>& rhs = m_productions[production].rhs;
+					if (rhs.empty() || seen[rhs[0]])
+						continue;
+					seen[rhs[0]] = true;
+					if (m_symbols[rhs[0]].type == SymbolType::NONTERMINAL)
+						stack.push_back(rhs[0]);
+				}
+			}
+		}
+	}
+
+	inline bool isAtEnd(const TrackedProduction& item) const
+	{
+		return item.pointer >= (int)m_productions[item.production].rhs.size();
+	}
+
+	// The symbol at the pointer, -1 at the end
+	inline int pointerSymbol(const TrackedProduction& item) const
+	{
+		return isAtEnd(item) ? -1 : m_productions[item.production].rhs[item.pointer];
+	}
+
+	// The kernel items followed by the start items of the closure of every
+	// nonterminal after a kernel pointer
+	ItemSet createItemSet(std::vector<TrackedProduction> kernel)
 	{
 		ItemSet itemSet;
 		itemSet.setNumber = m_itemSets.size();
-		itemSet.productions.insert(itemSet.productions.end(), productions.begin(), productions.end());
-		std::vector<TrackedProduction>* p = new std::vector<TrackedProduction>();
-		std::vector<TrackedProduction> closures = generateClosures(productions, p);
-		delete p;
-		itemSet.productions.insert(itemSet.productions.end(), closures.begin(), closures.end());
+		itemSet.productions = kernel;
+		std::vector<bool> expanded(m_symbols.size(), false), added(m_productions.size(), false);
+		for (const TrackedProduction& item : kernel)
+		{
+			int symbol = pointerSymbol(item);
+			if (symbol == -1 || m_symbols[symbol].type != SymbolType::NONTERMINAL || expanded[symbol])
+				continue;
+			expanded[symbol] = true;
+			for (int production : m_closures[symbol])
+			{
+				if (added[production])
+					continue;
+				added[production] = true;
+				itemSet.productions.push_back({ production, 0, {} });
+			}
+		}
 		return itemSet;
 	}
 
+	void printItemSet(const ItemSet& set)
+	{
+		std::cout << "I" << set.setNumber << std::endl;
+		for (const TrackedProduction& tProd : set.productions)
+		{
+			const InternedProduction& prod = m_productions[tProd.production];
+			std::cout << m_symbols[prod.lhs].symbol << " -> ";
+			for (int i = 0; i < (int)prod.rhs.size(); i++)
+			{
+				if (tProd.pointer == i)
+					std::cout << "%";
+				std::cout << m_symbols[prod.rhs[i]].symbol;
+			}
+			if (tProd.pointer == prod.rhs.size())
+				std::cout << "%";
+			if (tProd.lookAhead.empty())
+			{
+				std::cout << " {}" << std::endl;
+				continue;
+			}
+			std::cout << " { ";
+			for (int terminal = 0; terminal < (int)m_terminals.size(); terminal++)
+			{
+				if (tProd.lookAhead.contains(terminal))
+					std::cout << m_symbols[m_terminals[terminal]].symbol << " ";
+			}
+			std::cout << "}" << std::endl;
+		}
+	}
+
+	// Rows of a table as (column, entry code) pairs
+	typedef std::vector<std::pair<int, std::string>> SparseRow;
+
+	// Row displacement packing of a table, the slots of row r start at base[r]
+	// and a slot belongs to the row whose number is in check
+	struct CombTable
+	{
+		std::vector<int> base;
+		std::vector<int> check;
+		std::vector<std::string> entries;
+		int used = 0;
+	};
+
+	// Overlaps the rows into one vector, biggest rows first, each at the first
+	// displacement where all of its columns land on empty slots
+	CombTable packRows(const std::vector<SparseRow>& rows, int columns, const std::string& empty)
+	{
+		CombTable table;
+		table.base.assign(rows.size(), 0);
+		std::vector<int> order;
+		for (int i = 0; i < (int)rows.size(); i++)
+			order.push_back(i);
+		std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return rows[a].size() > rows[b].size(); });
+
+		int maxBase = 0;
+		for (int row : order)
+		{
+			if (rows[row].empty())
+				continue;
+			int base = 0;
+			while (true)
+			{
+				bool fits = true;
+				for (const std::pair<int, std::string>& entry : rows[row])
+				{
+					int slot = base + entry.first;
+					if (slot < (int)table.check.size() && table.check[slot] != -1)
+					{
+						fits = false;
+						break;
+					}
+				}
+				if (fits)
+					break;
+				base++;
+			}
+			for (const std::pair<int, std::string>& entry : rows[row])
+			{
+				int slot = base + entry.first;
+				if (slot >= (int)table.check.size())
+				{
+					table.check.resize(slot + 1, -1);
+					table.entries.resize(slot + 1, empty);
+				}
+				table.check[slot] = row;
+				table.entries[slot] = entry.second;
+				table.used++;
+			}
+			table.base[row] = base;
+			maxBase = std::max(maxBase, base);
+		}
+		// Any column of any row has to land inside the vector, even the empty ones
+		table.check.resize(std::max<size_t>(table.check.size(), maxBase + columns), -1);
+		table.entries.resize(table.check.size(), empty);
+		return table;
+	}
+
+	// The token types the grammar uses, in the order of their action table columns
+	std::vector<std::string> terminalNames()
+	{
+		std::set<std::string> names;
+		for (auto statePair : m_action)
+			for (auto tokenPair : statePair.second)
+				names.insert(getSymbolName(tokenPair.first));
+		return std::vector<std::string>(names.begin(), names.end());
+	}
+
+	std::string actionCode(const std::string& action)
+	{
+		switch (action[0])
+		{
+		case 'A': return "{ ActionType::Accept }";
+		case 'S': return std::string("{ ActionType::Shift, ").append(action.substr(1)).append(" }");
+		case 'R': return std::string("{ ActionType::Reduce, ").append(action.substr(1)).append(" }");
+		}
+		return "{}";
+	}
+
+	std::vector<SparseRow> actionRows(const std::vector<std::string>& terminals)
+	{
+		std::vector<SparseRow> rows(m_itemSets.size());
+		for (auto statePair : m_action)
+			for (auto tokenPair : statePair.second)
+			{
+				int column = (int)(std::lower_bound(terminals.begin(), terminals.end(), getSymbolName(tokenPair.first)) - terminals.begin());
+				rows[statePair.first].push_back({ column, actionCode(tokenPair.second) });
+			}
+		return rows;
+	}
+
+	// Node types are numbered in the order the NodeType enum is written in
+	std::vector<SparseRow> gotoRows()
+	{
+		std::unordered_map<std::string, int> columns;
+		for (const std::string& exp : m_expressions)
+			columns[exp] = (int)columns.size();
+		std::vector<SparseRow> rows(m_itemSets.size());
+		for (auto statePair : m_goto)
+			for (auto gotoPair : statePair.second)
+				rows[statePair.first].push_back({ columns[getSymbolName(gotoPair.first)], std::to_string(gotoPair.second) });
+		return rows;
+	}
+
+	void generateGrammar(std::string& contents)
+	{
+		contents.append("	static constexpr Production s_grammar[GRAMMAR_NUM] = {\n");
+		for (int i = 0; i < (int)m_grammar.getProductions().size(); i++)
+		{
+			Production p = m_grammar.getProductions()[i];
+			bool terminates = true;
+			int nonTerminals = 0;
+			for (const Symbol& symbol : p.rhs)
+				if (symbol.type == SymbolType::NONTERMINAL)
+				{
+					terminates = false;
+					nonTerminals++;
+				}
+			// mak eif you add a new token to a set and it adds onto the set it removes the links if it was changed because the new lookaheads were new
+			contents.append("		{ NodeType::").append(p.lhs.symbol).
+				append(", ").append(std::to_string(p.rhs.size())).append(", ").
+				append(std::to_string(nonTerminals)).append(", ").
+				append(terminates ? "true" : "false").append(", ").
+				append(isPassThrough(p) ? "true" : "false").append(" },\n");
+		}
+		contents.append("	};\n");
+	}
+
+	// Chains like Expression -> Logical -> ... -> Literal carry nothing, the parser
+	// still steps through them but keeps the child's node or value as it is
+	bool isPassThrough(const Production& production) const
+	{
+		return production.rhs.size() == 1 && production.rhs[0].type == SymbolType::NONTERMINAL && production.action.empty();
+	}
+
+	// The entry parse and build go through, streams without a type array get read
+	// through PulledTokens so the automaton only ever sees one kind of reader
+	void generateRunEntry(std::string& contents)
+	{
+		contents.append(
+			"\npublic:\n"
+			"	// The automaton both parse and build drive, they only differ in what they keep\n"
+			"	template<typename TokenStream, typename OnShift, typename OnReduce>\n"
+			"	void run(TokenStream& tokens, OnShift onShift, OnReduce onReduce)\n"
+			"	{\n"
+			"		if constexpr (requires { tokens.type(); })\n"
+			"			drive(tokens, onShift, onReduce);\n"
+			"		else\n"
+			"		{\n"
+			"			PulledTokens<TokenStream> pulled(tokens);\n"
+			"			drive(pulled, onShift, onReduce);\n"
+			"		}\n"
+			"	}\n"
+		);
+	}
+
+	// Every state is a label with a switch on the token. Shifts jump straight to the
+	// next state and reduces to a label per rule, which pops the stack and jumps
+	// to a switch on the state below to find the goto. The tables stay for the
+	// IncrementalParser but parse and build never look at them.
+	void generateDirectRun(std::string& contents)
+	{
+		std::set<int> rules;
+		std::set<std::string> nonTerminals;
+		contents.append(
+			"\n"
+			"	template<typename TokenReader, typename OnShift, typename OnReduce>\n"
+			"	void drive(TokenReader& tokens, OnShift onShift, OnReduce onReduce)\n"
+			"	{\n"
+			"		if (m_tables)\n"
+			"		{\n"
+			"			driveTables(tokens, onShift, onReduce);\n"
+			"			return;\n"
+			"		}\n"
+			"		std::vector<int> stack;\n"
+			"		stack.reserve(64);\n"
+			"		goto state0;\n"
+		);
+		for (int num = 0; num < (int)m_itemSets.size(); num++)
+		{
+			std::string state = std::to_string(num);
+			contents.append("	state" + state + ":\n		stack.push_back(" + state + ");\n");
+			int fallback = m_defaultReductions[num];
+			if (fallback != 0)
+				rules.insert(fallback);
+			if (m_reducesOnly[num])
+			{
+				contents.append("		goto reduce" + std::to_string(fallback) + ";\n");
+				continue;
+			}
+
+			// Tokens with the same action share the case, ordered by kind then target
+			std::map<std::pair<char, int>, std::vector<std::string>> cases;
+			for (auto& tokenPair : m_action[num])
+			{
+				const std::string& action = tokenPair.second;
+				cases[{ action[0], action[0] == 'S' || action[0] == 'R' ? std::stoi(action.substr(1)) : 0 }].push_back(getSymbolName(tokenPair.first));
+			}
+			contents.append("		switch (tokens.type())\n		{\n");
+			for (auto& casePair : cases)
+			{
+				std::sort(casePair.second.begin(), casePair.second.end());
+				contents.append("		");
+				for (const std::string& token : casePair.second)
+					contents.append("case TokenType::" + token + ": ");
+				std::string target = std::to_string(casePair.first.second);
+				if (casePair.first.first == 'S')
+					contents.append("onShift(tokens.token()); tokens.advance(); goto state" + target + ";\n");
+				else if (casePair.first.first == 'R')
+				{
+					rules.insert(casePair.first.second);
+					contents.append("goto reduce" + target + ";\n");
+				}
+				else
+					contents.append("return;\n");
+			}
+			contents.append("		default: goto " + (fallback != 0 ? "reduce" + std::to_string(fallback) : std::string("error")) + ";\n		}\n");
+		}
+
+		for (int rule : rules)
+		{
+			const Production& production = m_grammar.getProductions()[rule - 1];
+			nonTerminals.insert(production.lhs.symbol);
+			contents.append(
+				"	reduce" + std::to_string(rule) + ":\n"
+				"		stack.resize(stack.size() - " + std::to_string(production.rhs.size()) + ");\n"
+				"		onReduce(s_grammar[" + std::to_string(rule - 1) + "], " + std::to_string(rule) + ");\n"
+				"		goto goto" + production.lhs.symbol + ";\n"
+			);
+		}
+
+		// The most common target of a goto is the switch's default
+		for (const std::string& nonTerminal : nonTerminals)
+		{
+			std::map<int, std::vector<int>> targets;
+			for (auto& statePair : m_goto)
+			{
+				auto gotoPair = statePair.second.find(nonTerminal);
+				if (gotoPair != statePair.second.end())
+					targets[gotoPair->second].push_back(statePair.first);
+			}
+			int common = -1;
+			for (auto& target : targets)
+				if (common == -1 || target.second.size() > targets[common].size())
+					common = target.first;
+			contents.append("	goto" + nonTerminal + ":\n		switch (stack.back())\n		{\n");
+			for (auto& target : targets)
+			{
+				if (target.first == common)
+					continue;
+				std::sort(target.second.begin(), target.second.end());
+				contents.append("		");
+				for (int state : target.second)
+					contents.append("case " + std::to_string(state) + ": ");
+				contents.append("goto state" + std::to_string(target.first) + ";\n");
+			}
+			contents.append("		default: goto state" + std::to_string(common) + ";\n		}\n");
+		}
+
+		contents.append(
+			"	error:\n"
+			"		{\n"
+			"			LineIndex::Location at = LineIndex::script().locate(tokens.token().offset);\n"
+			"			if (tokens.type() == TokenType::_EOF)\n"
+			"				std::cout << \"Unexpected end of file at line \" << at.line << \" at pos \" << at.pos << std::endl;\n"
+			"			else\n"
+			"				std::cout << \"Error parsing line \" << at.line << \" at pos \" << at.pos << std::endl;\n"
+			"			exit(-2);\n"
+			"		}\n"
+			"	}\n"
+		);
+	}
+
+	// One case per rule with its action, $n becomes the nth value on the stack
+	void generateSemanticActions(std::string& contents)
+	{
+		contents.append("\nprivate:\n	static " + m_valueType + " reduceAction(int rule, " + m_valueType + "* rhs)\n	{\n		switch (rule)\n		{\n");
+		for (int i = 0; i < (int)m_grammar.getProductions().size(); i++)
+		{
+			const Production& production = m_grammar.getProductions()[i];
+			if (isPassThrough(production))
+				continue;
+			std::string action = production.action;
+			if (action.empty())
+				action = production.rhs.empty() ? "{}" : "std::move($1)";
+			std::string code;
+			for (size_t c = 0; c < action.size(); c++)
+			{
+				if (action[c] != '$')
+				{
+					code += action[c];
+					continue;
+				}
+				size_t digits = c + 1;
+				while (digits < action.size() && isdigit(action[digits]))
+					digits++;
+				code += "rhs[" + std::to_string(std::stoi(action.substr(c + 1, digits - c - 1)) - 1) + "]";
+				c = digits - 1;
+			}
+			contents.append("		case " + std::to_string(i + 1) + ": return " + code + ";\n");
+		}
+		contents.append("		}\n		return {};\n	}\n");
+	}
+
+	// Parser::loadTables, which checks a table file against this parser's token
+	// and node types and points the lookups into the mapped file
+	void generateTableLoading(std::string& contents)
+	{
+		contents.append(
+			"	// Swaps in tables Peg wrote with -tables, so a grammar over the same tokens and\n"
+			"	// node types can be run without a rebuild. The file is mapped and used in place.\n"
+			"	// The rules' actions are compiled in, so only parse() works with loaded tables\n"
+			"	bool loadTables(const char* path)\n"
+			"	{\n"
+			"		std::unique_ptr<LoadedTables> tables = std::make_unique<LoadedTables>();\n"
+			"		if (!tables->file.open(path))\n"
+			"			return tablesError(path, \"does not exist!\");\n"
+			"		std::string_view data = tables->file.view();\n"
+			"		TablesHeader header;\n"
+			"		if (data.size() < sizeof(header) || std::memcmp(data.data(), \"PEGT\", 4) != 0)\n"
+			"			return tablesError(path, \"is not a table file\");\n"
+			"		std::memcpy(&header, data.data(), sizeof(header));\n"
+			"		if (header.version != TABLES_VERSION)\n"
+			"			return tablesError(path, \"was written for version \" + std::to_string(header.version) + \" of the table format, expected \" + std::to_string(TABLES_VERSION));\n"
+			"		// Bound the counts by the file first so the size below cannot overflow\n"
+			"		if (header.namesSize > data.size() || (uint64_t)header.tokens + header.nodes > header.namesSize / 2 ||\n"
+			"			header.states > data.size() / sizeof(Action) || header.rules > data.size() / (4 * sizeof(int32_t)))\n"
+			"			return tablesError(path, \"is the wrong size\");\n"
+			"		size_t size = sizeof(header) + header.namesSize + (size_t)header.rules * 4 * sizeof(int32_t) + (size_t)header.states * sizeof(Action) +\n"
+			"			((size_t)header.states + 3) / 4 * 4 + (size_t)header.states * header.tokens * sizeof(Action) + (size_t)header.states * header.nodes * sizeof(int32_t);\n"
+			"		if (data.size() != size || header.states == 0 || header.namesSize % 4 != 0)\n"
+			"			return tablesError(path, \"is the wrong size\");\n"
+			"\n"
+			"		// Columns are matched to this parser's types by name\n"
+			"		tables->tokenColumns.fill(-1);\n"
+			"		tables->nodeColumns.fill(-1);\n"
+			"		std::vector<NodeType> nodeTypes;\n"
+			"		const char* names = data.data() + sizeof(header);\n"
+			"		const char* namesEnd = names + header.namesSize;\n"
+			"		for (uint32_t i = 0; i < header.tokens + header.nodes; i++)\n"
+			"		{\n"
+			"			const char* end = std::find(names, namesEnd, '\\0');\n"
+			"			if (end == namesEnd)\n"
+			"				return tablesError(path, \"is corrupt\");\n"
+			"			std::string_view name(names, end - names);\n"
+			"			names = end + 1;\n"
+			"			if (i < header.tokens)\n"
+			"			{\n"
+			"				auto token = std::find_if(std::begin(s_tokenNames), std::end(s_tokenNames), [&](const auto& pair) { return name == pair.first; });\n"
+			"				if (token == std::end(s_tokenNames))\n"
+			"					return tablesError(path, \"uses the unknown token \" + std::string(name));\n"
+			"				tables->tokenColumns[(int)token->second] = (int)i;\n"
+			"			}\n"
+			"			else\n"
+			"			{\n"
+			"				auto node = std::find(std::begin(s_nodeNames), std::end(s_nodeNames), name);\n"
+			"				if (node == std::end(s_nodeNames))\n"
+			"					return tablesError(path, \"uses the unknown node type \" + std::string(name));\n"
+			"				tables->nodeColumns[node - std::begin(s_nodeNames)] = (int)nodeTypes.size();\n"
+			"				nodeTypes.push_back((NodeType)(node - std::begin(s_nodeNames)));\n"
+			"			}\n"
+			"		}\n"
+			"\n"
+			"		const int32_t* rules = (const int32_t*)namesEnd;\n"
+			"		for (uint32_t i = 0; i < header.rules; i++)\n"
+			"		{\n"
+			"			const int32_t* rule = rules + i * 4;\n"
+			"			// A rule terminates when it has no nodes and passes through a single node\n"
+			"			bool terminates = (rule[3] & 1) != 0, passThrough = (rule[3] & 2) != 0;\n"
+			"			if (rule[0] < 0 || rule[0] >= (int32_t)header.nodes || rule[1] < 0 || rule[2] < 0 || rule[2] > rule[1] ||\n"
+			"				(rule[3] & ~3) != 0 || terminates != (rule[2] == 0) || (passThrough && (rule[1] != 1 || rule[2] != 1)))\n"
+			"				return tablesError(path, \"is corrupt\");\n"
+			"			tables->grammar.push_back({ nodeTypes[rule[0]], rule[1], rule[2], terminates, passThrough });\n"
+			"		}\n"
+			"		const char* next = (const char*)(rules + header.rules * 4);\n"
+			"		tables->defaultActions = (const Action*)next;\n"
+			"		next += header.states * sizeof(Action);\n"
+			"		tables->reducesOnly = (const uint8_t*)next;\n"
+			"		next += (header.states + 3) / 4 * 4;\n"
+			"		tables->actions = (const Action*)next;\n"
+			"		next += (size_t)header.states * header.tokens * sizeof(Action);\n"
+			"		tables->gotos = (const int32_t*)next;\n"
+			"\n"
+			"		// Every state and rule the parse can reach is checked here once, so a bad\n"
+			"		// file is turned away instead of being walked\n"
+			"		auto validAction = [&](const Action& entry) {\n"
+			"			switch (entry.type)\n"
+			"			{\n"
+			"			case ActionType::None:\n"
+			"			case ActionType::Accept: return true;\n"
+			"			case ActionType::Shift: return entry.value >= 0 && entry.value < (int)header.states;\n"
+			"			case ActionType::Reduce: return entry.value >= 1 && entry.value <= (int)header.rules;\n"
+			"			}\n"
+			"			return false;\n"
+			"		};\n"
+			"		if (!std::all_of(tables->defaultActions, tables->defaultActions + header.states, validAction) ||\n"
+			"			!std::all_of(tables->actions, tables->actions + (size_t)header.states * header.tokens, validAction) ||\n"
+			"			!std::all_of(tables->gotos, tables->gotos + (size_t)header.states * header.nodes, [&](int32_t state) { return state >= 0 && state < (int32_t)header.states; }))\n"
+			"			return tablesError(path, \"is corrupt\");\n"
+			"		tables->tokens = header.tokens;\n"
+			"		tables->nodes = header.nodes;\n"
+			"		m_tables = std::move(tables);\n"
+			"		return true;\n"
+			"	}\n"
+			"	inline bool hasLoadedTables() const { return m_tables != nullptr; }\n"
+			"\n"
+		);
+	}
+
+	// The lookups into a mapped table file and the names its columns are matched by
+	void generateLoadedTables(std::string& contents, const std::vector<std::string>& terminals)
+	{
+		contents.append(
+			"\n"
+			"	static_assert(sizeof(Action) == 2 * sizeof(int32_t), \"Table files store actions as two words\");\n"
+			"	struct LoadedTables\n"
+			"	{\n"
+			"		SourceFile file;\n"
+			"		uint32_t tokens = 0, nodes = 0;\n"
+			"		const Action* defaultActions = nullptr;\n"
+			"		const uint8_t* reducesOnly = nullptr;\n"
+			"		const Action* actions = nullptr;\n"
+			"		const int32_t* gotos = nullptr;\n"
+			"		std::vector<Production> grammar;\n"
+			"		// The file's column for each of this parser's types, -1 if it has none\n"
+			"		std::array<int, TOKEN_NUM> tokenColumns;\n"
+			"		std::array<int, NODE_NUM> nodeColumns;\n"
+			"\n"
+			"		inline const Action& action(int state, TokenType type) const\n"
+			"		{\n"
+			"			int column = tokenColumns[(int)type];\n"
+			"			if (reducesOnly[state] || column == -1)\n"
+			"				return defaultActions[state];\n"
+			"			const Action& entry = actions[state * tokens + column];\n"
+			"			return entry.type != ActionType::None ? entry : defaultActions[state];\n"
+			"		}\n"
+			"		inline int gotoState(int state, NodeType type) const\n"
+			"		{\n"
+			"			int column = nodeColumns[(int)type];\n"
+			"			return column == -1 ? 0 : gotos[state * nodes + column];\n"
+			"		}\n"
+			"	};\n"
+			"	std::unique_ptr<LoadedTables> m_tables;\n"
+			"\n"
+			"	static bool tablesError(const char* path, const std::string& reason)\n"
+			"	{\n"
+			"		std::cout << path << \" \" << reason << std::endl;\n"
+			"		return false;\n"
+			"	}\n"
+			"\n"
+			"	// Loaded tables whose entries are in range can still pop more than was pushed or never stop reducing\n"
+			"	[[noreturn]] static void corruptTables()\n"
+			"	{\n"
+			"		std::cout << \"The loaded parse tables are corrupt\" << std::endl;\n"
+			"		exit(-2);\n"
+			"	}\n"
+			"\n"
+			"	static constexpr std::pair<const char*, TokenType> s_tokenNames[] = {"
+		);
+		for (int i = 0; i < (int)terminals.size(); i++)
+			contents.append(i % 4 == 0 ? "\n		" : " ").append("{ \"" + terminals[i] + "\", TokenType::" + terminals[i] + " },");
+		contents.append("\n	};\n	static constexpr const char* s_nodeNames[NODE_NUM] = {");
+		int i = 0;
+		for (const std::string& exp : m_expressions)
+			contents.append(i++ % 6 == 0 ? "\n		" : " ").append("\"" + exp + "\",");
+		contents.append("\n	};\n");
+	}
+
+	// What a state does when the token has no entry, nothing or its default reduction
+	void generateDefaultReductions(std::string& contents)
+	{
+		contents.append("	static constexpr Action s_defaultActions[SET_NUM] = {\n");
+		for (int rule : m_defaultReductions)
+			contents.append(rule == 0 ? "		{},\n" : "		{ ActionType::Reduce, " + std::to_string(rule) + " },\n");
+		contents.append(
+			"	};\n"
+			"	static constexpr bool s_reducesOnly[SET_NUM] = {"
+		);
+		for (int i = 0; i < (int)m_reducesOnly.size(); i++)
+			contents.append(i % 16 == 0 ? "\n		" : " ").append(m_reducesOnly[i] ? "true" : "false").append(",");
+		contents.append("\n	};\n");
+	}
+
+	// One row per state with a column for every token or node type. A constexpr
+	// lambda fills them in so the entries can be written with the enum names
+	void generateDenseTables(std::string& contents)
+	{
+		contents.append(
+			"	// Table lookups for drivers that run the automaton themselves, e.g. the IncrementalParser\n"
+			"	inline const Action& action(int state, TokenType type) const\n"
+			"	{\n"
+			"		if (m_tables)\n"
+			"			return m_tables->action(state, type);\n"
+			"		// States that reduce the same way on every token never look at it\n"
+			"		if (s_reducesOnly[state])\n"
+			"			return s_defaultActions[state];\n"
+			"		const Action& entry = s_actionTable[state][(int)type];\n"
+			"		return entry.type != ActionType::None ? entry : s_defaultActions[state];\n"
+			"	}\n"
+			"	inline int gotoState(int state, NodeType type) const { return m_tables ? m_tables->gotoState(state, type) : s_gotoTable[state][(int)type]; }\n"
+			"	// Takes the value of a reduce action, rules are numbered from 1\n"
+			"	inline const Production& production(int rule) const { return m_tables ? m_tables->grammar[rule - 1] : s_grammar[rule - 1]; }\n"
+			"private:\n"
+			"	using ActionTable = std::array<std::array<Action, TOKEN_NUM>, SET_NUM>;\n"
+			"	using GotoTable = std::array<std::array<int, NODE_NUM>, SET_NUM>;\n"
+			"\n"
+		);
+		generateGrammar(contents);
+		generateDefaultReductions(contents);
+
+		contents.append(
+			"	static constexpr ActionTable s_actionTable = [] {\n"
+			"		ActionTable table{};\n"
+		);
+		for (int num = 0; num < (int)m_itemSets.size(); num++)
+		{
+			if (m_action.find(num) == m_action.end())
+				continue;
+			for (auto tokenPair : m_action[num])
+				contents.append("		table[").append(std::to_string(num)).append("][(int)TokenType::").append(getSymbolName(tokenPair.first)).
+					append("] = ").append(actionCode(tokenPair.second)).append(";\n");
+		}
+		contents.append(
+			"		return table;\n"
+			"	}();\n"
+			"	static constexpr GotoTable s_gotoTable = [] {\n"
+			"		GotoTable table{};\n"
+		);
+		for (int num = 0; num < (int)m_itemSets.size(); num++)
+		{
+			if (m_goto.find(num) == m_goto.end())
+				continue;
+			for (auto gotoPair : m_goto[num])
+				contents.append("		table[").append(std::to_string(num)).append("][(int)NodeType::").append(getSymbolName(gotoPair.first)).
+					append("] = ").append(std::to_string(gotoPair.second)).append(";\n");
+		}
+		contents.append(
+			"		return table;\n"
+			"	}();\n"
+		);
+	}
+
+	// The rows of both tables overlapped into one vector each. Token types go
+	// through a column map first since Peg does not know the TokenType order,
+	// the ones the grammar never uses get a column no state has entries in
+	void generateCombTables(std::string& contents, const CombTable& actions, const CombTable& gotos)
+	{
+		std::vector<std::string> terminals = terminalNames();
+		std::string checkType = m_itemSets.size() < 0xFFFF ? "uint16_t" : "int32_t";
+		contents.append(
+			"	// Table lookups for drivers that run the automaton themselves, e.g. the IncrementalParser.\n"
+			"	// A slot only holds the state's entry when its check is the state\n"
+			"	inline const Action& action(int state, TokenType type) const\n"
+			"	{\n"
+			"		if (m_tables)\n"
+			"			return m_tables->action(state, type);\n"
+			"		// States that reduce the same way on every token never look at it\n"
+			"		if (s_reducesOnly[state])\n"
+			"			return s_defaultActions[state];\n"
+			"		int slot = s_actionBase[state] + s_tokenColumn[(int)type];\n"
+			"		return s_actionCheck[slot] == state ? s_actionEntries[slot] : s_defaultActions[state];\n"
+			"	}\n"
+			"	inline int gotoState(int state, NodeType type) const\n"
+			"	{\n"
+			"		if (m_tables)\n"
+			"			return m_tables->gotoState(state, type);\n"
+			"		int slot = s_gotoBase[state] + (int)type;\n"
+			"		return s_gotoCheck[slot] == state ? s_gotoEntries[slot] : 0;\n"
+			"	}\n"
+			"	// Takes the value of a reduce action, rules are numbered from 1\n"
+			"	inline const Production& production(int rule) const { return m_tables ? m_tables->grammar[rule - 1] : s_grammar[rule - 1]; }\n"
+			"private:\n"
+		);
+		generateGrammar(contents);
+		generateDefaultReductions(contents);
+
+		contents.append("	static constexpr std::array<uint16_t, TOKEN_NUM> s_tokenColumn = [] {\n"
+			"		std::array<uint16_t, TOKEN_NUM> columns{};\n"
+			"		for (uint16_t& column : columns)\n"
+			"			column = ").append(std::to_string(terminals.size())).append(";\n");
+		for (int i = 0; i < (int)terminals.size(); i++)
+			contents.append("		columns[(int)TokenType::").append(terminals[i]).append("] = ").append(std::to_string(i)).append(";\n");
+		contents.append(
+			"		return columns;\n"
+			"	}();\n"
+		);
+
+		auto appendList = [&](const std::string& declaration, const std::vector<std::string>& items, int perLine) {
+			contents.append("	static constexpr ").append(declaration).append(" = {");
+			for (int i = 0; i < (int)items.size(); i++)
+			{
+				if (i % perLine == 0)
+					contents.append("\n		");
+				else
+					contents.append(" ");
+				contents.append(items[i]).append(",");
+			}
+			contents.append("\n	};\n");
+		};
+		auto numbers = [](const std::vector<int>& values, int empty) {
+			std::vector<std::string> items;
+			for (int value : values)
+				items.push_back(std::to_string(value == -1 ? empty : value));
+			return items;
+		};
+		int emptyCheck = checkType == "uint16_t" ? 0xFFFF : -1;
+		appendList("int s_actionBase[SET_NUM]", numbers(actions.base, 0), 16);
+		appendList(checkType + " s_actionCheck[" + std::to_string(actions.check.size()) + "]", numbers(actions.check, emptyCheck), 16);
+		appendList("Action s_actionEntries[" + std::to_string(actions.entries.size()) + "]", actions.entries, 4);
+		appendList("int s_gotoBase[SET_NUM]", numbers(gotos.base, 0), 16);
+		appendList(checkType + " s_gotoCheck[" + std::to_string(gotos.check.size()) + "]", numbers(gotos.check, emptyCheck), 16);
+		appendList("int s_gotoEntries[" + std::to_string(gotos.entries.size()) + "]", gotos.entries, 16);
+	}
+
+	// Prints how big the tables are in each layout and how many loads a lookup
+	// takes, the comb layout pays an extra load or two to stay in cache
+	void reportTables(TableLayout layout, const CombTable& actions, const CombTable& gotos)
+	{
+		size_t states = m_itemSets.size();
+		size_t terminals = terminalNames().size();
+		size_t checkSize = states < 0xFFFF ? 2 : 4;
+		size_t actionSize = 8, gotoSize = 4;
+
+		std::cout << "Action table: " << states << " states, " << terminals << " tokens, " << actions.used << " actions" << std::endl;
+		std::cout << "   dense: " << states * terminals * actionSize << " bytes, 1 load per lookup" << std::endl;
+		std::cout << "   comb: " << states * 4 + actions.check.size() * (checkSize + actionSize) + (terminals + 1) * 2 << " bytes, " <<
+			actions.check.size() << " slots " << actions.used * 100 / actions.check.size() << "% filled, 4 loads per lookup" << std::endl;
+		std::cout << "Goto table: " << states << " states, " << m_expressions.size() << " node types, " << gotos.used << " gotos" << std::endl;
+		std::cout << "   dense: " << states * m_expressions.size() * gotoSize << " bytes, 1 load per lookup" << std::endl;
+		std::cout << "   comb: " << states * 4 + gotos.check.size() * (checkSize + gotoSize) << " bytes, " <<
+			gotos.check.size() << " slots " << gotos.used * 100 / gotos.check.size() << "% filled, 3 loads per lookup" << std::endl;
+		int defaults = 0, reducesOnly = 0;
+		for (int i = 0; i < (int)states; i++)
+		{
+			defaults += m_defaultReductions[i] != 0;
+			reducesOnly += m_reducesOnly[i];
+		}
+		std::cout << defaults << " states have a default reduction, " << reducesOnly << " of them never look at the token" << std::endl;
+		int passThrough = 0;
+		for (const Production& production : m_grammar.getProductions())
+			passThrough += isPassThrough(production);
+		std::cout << passThrough << " of " << m_grammar.getProductions().size() << " rules pass their child through" << std::endl;
+		std::cout << m_resolvedConflicts << " conflicts resolved by precedence, " << m_unresolvedConflicts << " resolved as a reduce" << std::endl;
+		std::cout << "Generated the " << (layout == TableLayout::Dense ? "dense" : layout == TableLayout::Comb ? "comb" : "direct coded") << " layout" << std::endl;
+	}
+
 	std::string getSymbolName(const std::string& symbol)
 	{
 		if (m_typeSubstitution.find(symbol) != m_typeSubstitution.end())
@@ -409,30 +1437,108 @@ private:
 		return symbol;
 	}
 
+	// Takes each state's most common reduction out of its row and makes it the
+	// state's default. Reducing on a token that is an error only changes the
+	// stack, the error still comes up before that token is shifted
+	void defineDefaultReductions()
+	{
+		m_defaultReductions.assign(m_itemSets.size(), 0);
+		m_reducesOnly.assign(m_itemSets.size(), false);
+		for (auto& statePair : m_action)
+		{
+			// A default reduction would run on the tokens %nonassoc made errors, so
+			// states with any keep all their reductions in the row
+			bool hasErrors = false;
+			for (auto it = statePair.second.begin(); it != statePair.second.end();)
+			{
+				if (it->second == "E")
+				{
+					hasErrors = true;
+					it = statePair.second.erase(it);
+				}
+				else
+					it++;
+			}
+			if (hasErrors)
+				continue;
+
+			std::unordered_map<std::string, int> counts;
+			std::string best;
+			int bestCount = 0;
+			for (auto& tokenPair : statePair.second)
+			{
+				if (tokenPair.second[0] != 'R')
+					continue;
+				int count = ++counts[tokenPair.second];
+				if (count > bestCount)
+				{
+					best = tokenPair.second;
+					bestCount = count;
+				}
+			}
+			if (best.empty())
+				continue;
+
+			m_defaultReductions[statePair.first] = std::stoi(best.substr(1));
+			for (auto it = statePair.second.begin(); it != statePair.second.end();)
+			{
+				if (it->second == best)
+					it = statePair.second.erase(it);
+				else
+					it++;
+			}
+			m_reducesOnly[statePair.first] = statePair.second.empty();
+		}
+	}
+
+	// The shifts are already in from createSets, so a reduce on a token that shifts is
+	// a conflict. When both the rule and the token have a precedence the tighter one
+	// wins, on a tie the associativity picks and %nonassoc makes the token an error.
+	// Anything else still goes to the reduce
+	void defineReduce(int state, const std::string& lookAhead, int rule)
+	{
+		std::string reduce = "R" + std::to_string(rule);
+		std::string& entry = m_action[state][lookAhead];
+		if (!entry.empty() && entry[0] == 'S')
+		{
+			Precedence rulePrecedence = m_grammar.getPrecedence(m_grammar.getProductions()[rule - 1]);
+			Precedence tokenPrecedence = m_grammar.getPrecedence(lookAhead);
+			if (rulePrecedence.level != 0 && tokenPrecedence.level != 0)
+			{
+				m_resolvedConflicts++;
+				if (tokenPrecedence.level > rulePrecedence.level ||
+					(tokenPrecedence.level == rulePrecedence.level && tokenPrecedence.associativity == Associativity::Right))
+					return;
+				if (tokenPrecedence.level == rulePrecedence.level && tokenPrecedence.associativity == Associativity::NonAssoc)
+					entry = "E";
+				else
+					entry = reduce;
+				return;
+			}
+			m_unresolvedConflicts++;
+		}
+		else if (!entry.empty() && entry != reduce)
+			m_unresolvedConflicts++;
+		entry = reduce;
+	}
+
 	void defineActions()
 	{
 		for (ItemSet& set : m_itemSets)
 		{
 			for (TrackedProduction& production : set.productions)
 			{
-				if (production.isAtEnd())
+				if (isAtEnd(production))
 				{
-					if (production.production == m_augmentedProduction)
-					{
-						for (Symbol lookAhead : production.lookAhead)
-							m_action[set.setNumber][lookAhead.symbol] = "Accept";
-					}
-					else
+					for (int terminal = 0; terminal < (int)m_terminals.size(); terminal++)
 					{
-						for (int i = 0; i < (int)m_grammar.getProductions().size(); i++)
-						{
-							if (production.production == (Production)m_grammar.getProductions()[i])
-							{
-								for (Symbol lookAhead : production.lookAhead)
-									m_action[set.setNumber][lookAhead.symbol] = std::string("R") + std::to_string(i + 1);
-								break;
-							}
-						}
+						if (!production.lookAhead.contains(terminal))
+							continue;
+						const std::string& lookAhead = m_symbols[m_terminals[terminal]].symbol;
+						if (production.production == m_augmentedProduction)
+							m_action[set.setNumber][lookAhead] = "Accept";
+						else
+							defineReduce(set.setNumber, lookAhead, production.production + 1);
 					}
 				}
 			}
@@ -468,281 +1574,183 @@ private:
 
 	void createSets(int setNum)
 	{
-		// Collects all productions where the pointer can be advanced and assign to its respective left side nonterminal symbol
-		std::unordered_map<Symbol, std::vector<TrackedProduction>> nextProductions;
+		// Collects all productions where the pointer can be advanced, grouped by the symbol at the pointer
+		std::vector<int> symbols;
+		std::unordered_map<int, std::vector<TrackedProduction>> nextProductions;
 		for (TrackedProduction& prod : m_itemSets[setNum].productions)
 		{
-			if (!prod.isAtEnd())
-			{
-				Symbol& symbol = prod.production.rhs[prod.pointer];
-				if (nextProductions.find(symbol) == nextProductions.end())
-				{
-					nextProductions[symbol] = { prod };
-				}
-				else
-				{
-					nextProductions[symbol].push_back(prod);
-				}
-			}
+			int symbol = pointerSymbol(prod);
+			if (symbol == -1)
+				continue;
+			if (nextProductions.find(symbol) == nextProductions.end())
+				symbols.push_back(symbol);
+			nextProductions[symbol].push_back(prod);
 		}
-		// For each symbol find the productions, increment the pointer, and generate an item set for that
-		// If an item set already exists then just point to the pre existing item set
-		for (auto symbol : nextProductions)
+		// For each symbol increment the pointers and look the kernel up, if an item set
+		// already has it then just point to the pre existing item set
+		for (int symbol : symbols)
 		{
-			for (TrackedProduction& production : symbol.second)
-			{
+			std::vector<TrackedProduction>& kernel = nextProductions[symbol];
+			for (TrackedProduction& production : kernel)
 				production.pointer++;
-			}
-			ItemSet newSet = createItemSet(symbol.second);
-			bool setExists = false;
-			for (ItemSet& dupSet : m_itemSets)
+			std::sort(kernel.begin(), kernel.end(), [](const TrackedProduction& a, const TrackedProduction& b) {
+				return a.production != b.production ? a.production < b.production : a.pointer < b.pointer;
+			});
+			std::vector<int> key;
+			key.reserve(kernel.size() * 2);
+			for (const TrackedProduction& production : kernel)
 			{
-				if (dupSet.productions.size() == newSet.productions.size())
-				{
-					bool equal = true;
-					for (int i = 0; i < (int)newSet.productions.size(); i++)
-					{
-						if (dupSet.productions[i].production == newSet.productions[i].production &&
-							dupSet.productions[i].pointer == newSet.productions[i].pointer)
-							continue;
-						equal = false;
-						break;
-					}
-					if (equal)
-					{
-						for (int i = 0; i < (int)newSet.productions.size(); i++)
-						{
-							for (Symbol look : newSet.productions[i].lookAhead)
-								dupSet.productions[i].lookAhead.insert(look);
-						}
-						newSet = dupSet;
-						setExists = true;
-					}
-				}
+				key.push_back(production.production);
+				key.push_back(production.pointer);
 			}
-			if (!setExists)
+
+			int setNumber;
+			auto existing = m_kernels.find(key);
+			if (existing != m_kernels.end())
+				setNumber = existing->second;
+			else
 			{
-				m_itemSets.push_back(newSet);
-				m_setBus.push(newSet.setNumber);
+				ItemSet newSet = createItemSet(kernel);
+				setNumber = newSet.setNumber;
+				m_kernels[key] = setNumber;
+				m_itemSets.push_back(std::move(newSet));
+				m_setBus.push(setNumber);
 			}
-			m_itemSets[setNum].next[symbol.first] = newSet.setNumber;
+			m_itemSets[setNum].next[symbol] = setNumber;
 			// If its a nonterminal create a goto entry
 			// If its a terminal create a shift action entry
-			if (symbol.first.type == SymbolType::NONTERMINAL)
+			if (m_symbols[symbol].type == SymbolType::NONTERMINAL)
 			{
-				m_goto[setNum][symbol.first.symbol] = newSet.setNumber;
+				m_goto[setNum][m_symbols[symbol].symbol] = setNumber;
 			}
-			else if (symbol.first.type == SymbolType::TERMINAL)
+			else if (m_symbols[symbol].type == SymbolType::TERMINAL)
 			{
-				m_action[setNum][symbol.first.symbol] = std::string("S") + std::to_string(newSet.setNumber);
+				m_action[setNum][m_symbols[symbol].symbol] = std::string("S") + std::to_string(setNumber);
 			}
 		}
 	}
 
-	std::vector<TrackedProduction> removeAndCollectClosures(std::vector<TrackedProduction> closures)
+	// LALR(1) look aheads by DeRemer and Pennello. Every nonterminal transition (p, A)
+	// gets the terminals that can follow A after p, an item A -> w of the set the
+	// transition's productions walk to then looks ahead to the union of those.
+	// Read(p, A) is what the set after A shifts, plus what nullable nonterminals
+	// it reads through. Follow(p, A) adds Follow(p', B) for each B -> xAy with y
+	// nullable and p' reaching p on x.
+	void generateLookAheads()
 	{
-		std::vector<TrackedProduction> newClosures;
-		for (TrackedProduction& closure : closures)
+		std::vector<std::pair<int, int>> transitions;
+		std::unordered_map<long long, int> transitionIds;
+		auto transitionId = [&](int state, int symbol) {
+			return transitionIds.at((long long)state * m_symbols.size() + symbol);
+		};
+		for (ItemSet& set : m_itemSets)
 		{
-			bool found = false;
-			for (TrackedProduction& prod : newClosures)
+			for (auto& next : set.next)
 			{
-				if (prod.pointer == closure.pointer && prod.production == closure.production)
-				{
-					for (Symbol lookAhead : closure.lookAhead)
-					{
-						if (prod.lookAhead.find(lookAhead) == prod.lookAhead.end())
-							prod.lookAhead.insert(lookAhead);
-					}
-					found = true;
-				}
+				if (m_symbols[next.first].type != SymbolType::NONTERMINAL)
+					continue;
+				transitionIds[(long long)set.setNumber * m_symbols.size() + next.first] = (int)transitions.size();
+				transitions.push_back({ set.setNumber, next.first });
 			}
-			if (!found)
-				newClosures.push_back(closure);
 		}
-		return newClosures;
-	}
 
-	std::unordered_map<int, std::unordered_set<int>> m_lookAheadLinks;
-	std::queue<std::pair<int, std::vector<TrackedProduction>>> m_lookAheadBus;
-	void generateLookAheads(ItemSet& set, std::vector<TrackedProduction> startProdutions)
-	{
-		// Find the next symbols that need look ahead closures
-		std::stack<Symbol> next;
-		for (TrackedProduction& prod : set.productions)
+		std::vector<TerminalSet> follows(transitions.size());
+		std::vector<std::vector<int>> reads(transitions.size()), includes(transitions.size());
+		int startSymbol = m_productions[m_augmentedProduction].rhs[0];
+		for (int t = 0; t < (int)transitions.size(); t++)
 		{
-			for (TrackedProduction& start : startProdutions)
+			int state = m_itemSets[transitions[t].first].next.at(transitions[t].second);
+			for (auto& next : m_itemSets[state].next)
+			{
+				if (m_symbols[next.first].type == SymbolType::TERMINAL)
+					follows[t].insert(m_terminalIndex[next.first]);
+				else if (m_nullable[next.first])
+					reads[t].push_back(transitionId(state, next.first));
+			}
+			if (transitions[t].first == 0 && transitions[t].second == startSymbol)
+				follows[t].insert(m_terminalIndex[m_endSymbol]);
+
+			// Walk each production of the transition's nonterminal from its state
+			for (int production : m_productionsOf[transitions[t].second])
 			{
-				if (start.pointer == prod.pointer && start.production == prod.production)
+				const std::vector<int>& rhs = m_productions[production].rhs;
+				int nullableFrom = (int)rhs.size();
+				while (nullableFrom > 0 && m_nullable[rhs[nullableFrom - 1]])
+					nullableFrom--;
+				int walk = transitions[t].first;
+				for (int i = 0; i < (int)rhs.size(); i++)
 				{
-					if (!prod.isAtEnd())
-						next.push(prod.production.rhs[prod.pointer]);
+					if (m_symbols[rhs[i]].type == SymbolType::NONTERMINAL && i + 1 >= nullableFrom)
+						includes[transitionId(walk, rhs[i])].push_back(t);
+					walk = m_itemSets[walk].next.at(rhs[i]);
 				}
 			}
 		}
+		digraph(reads, follows);
+		digraph(includes, follows);
 
-		// Iterate over look ahead closures
-		while (!next.empty())
+		// Hand the follows to the items of each production walked from the transition
+		std::vector<std::map<std::pair<int, int>, int>> items(m_itemSets.size());
+		for (ItemSet& set : m_itemSets)
 		{
-			Symbol nSymbol = next.top();
-			next.pop();
-			for (TrackedProduction& prod : set.productions)
-			{
-				if (!prod.isAtEnd())
-					if (prod.production.rhs[prod.pointer] == nSymbol)
-					{
-						for (TrackedProduction& cursorProd : set.productions)
-						{
-							if (cursorProd.production.lhs == nSymbol)
-							{
-								// Finds the production to create look ahead closure for
-								bool hasAll = true;
-								// If look ahead of current token will be the end, just transfer all the look aheads of the current to the next
-								if (prod.pointer + 1 == prod.production.rhs.size())
-									for (Symbol s : prod.lookAhead)
-									{
-										if (cursorProd.lookAhead.find(s) == cursorProd.lookAhead.end())
-										{
-											cursorProd.lookAhead.insert(s);
-											hasAll = false;
-										}
-									}
-								else if (cursorProd.lookAhead.find(prod.nextSymbol()) == cursorProd.lookAhead.end())
-								{
-									// Adds look ahead of the current token to the next token rules
-									cursorProd.lookAhead.insert(prod.nextSymbol());
-									hasAll = false;
-								}
-								// Push the current pointed token to create  look ahead closures
-								if (!cursorProd.isAtEnd() && !hasAll)
-									if (cursorProd.production.rhs[cursorProd.pointer].type == SymbolType::NONTERMINAL)
-										next.push(cursorProd.production.rhs[cursorProd.pointer]);
-							}
-						}
-					}
-			}
+			for (int i = 0; i < (int)set.productions.size(); i++)
+				items[set.setNumber][{ set.productions[i].production, set.productions[i].pointer }] = i;
 		}
-		// For each item set, determine the productions where the pointer was advanced and copy the look ahead tokens to them
-		// Then add to the look ahead bus the item set with new tokens to update any new look ahead closures
-		for (auto& pair : set.next)
+		for (int t = 0; t < (int)transitions.size(); t++)
 		{
-			if (m_lookAheadLinks.find(set.setNumber) != m_lookAheadLinks.end() && m_lookAheadLinks[set.setNumber].find(pair.second) != m_lookAheadLinks[set.setNumber].end())
-				continue;
-			ItemSet& nextSet = m_itemSets[pair.second];
-			std::vector<TrackedProduction> nextProductions;
-			bool changed = false;
-			for (TrackedProduction& prod : nextSet.productions)
+			for (int production : m_productionsOf[transitions[t].second])
 			{
-				if (prod.pointer > 0)
+				const std::vector<int>& rhs = m_productions[production].rhs;
+				int walk = transitions[t].first;
+				for (int i = 0; ; i++)
 				{
-					TrackedProduction comparison = prod;
-					comparison.pointer--;
-					for (TrackedProduction& tracked : set.productions)
-					{
-						if (tracked.pointer == comparison.pointer && tracked.production == comparison.production)
-						{
-							for (const Symbol& lookSymbol : tracked.lookAhead)
-							{
-								if (prod.lookAhead.find(lookSymbol) == prod.lookAhead.end())
-									changed = true;
-								prod.lookAhead.insert(lookSymbol);
-							}
-							nextProductions.push_back(prod);
-							break;
-						}
-					}
+					m_itemSets[walk].productions[items[walk].at({ production, i })].lookAhead.unite(follows[t]);
+					if (i == (int)rhs.size())
+						break;
+					walk = m_itemSets[walk].next.at(rhs[i]);
 				}
 			}
-			if (changed)
-			{
-				m_lookAheadLinks[pair.second] = std::unordered_set<int>();
-			}
-			if (m_lookAheadLinks.find(set.setNumber) == m_lookAheadLinks.end())
-				m_lookAheadLinks[set.setNumber] = std::unordered_set<int>();
-			m_lookAheadLinks[set.setNumber].insert(pair.second);
-			std::cout << set.setNumber << " -> " << pair.second << std::endl;
-			m_lookAheadBus.push(std::make_pair(pair.second, nextProductions));
 		}
+		int endTerminal = m_terminalIndex[m_endSymbol];
+		m_itemSets[0].productions[0].lookAhead.insert(endTerminal);
+		int accepting = m_itemSets[0].next.at(startSymbol);
+		m_itemSets[accepting].productions[items[accepting].at({ m_augmentedProduction, 1 })].lookAhead.insert(endTerminal);
 	}
 
-	void deriveLookAheads(ItemSet& set)
+	// Unions into each set the sets of everything it relates to, a strongly
+	// connected component shares one set
+	void digraph(const std::vector<std::vector<int>>& relation, std::vector<TerminalSet>& sets)
 	{
-		for (TrackedProduction& prod : set.productions)
-		{
-			std::stack<Symbol, std::vector<Symbol>> aheadStack(std::vector<Symbol>(prod.lookAhead.begin(), prod.lookAhead.end()));
-			std::unordered_set<Symbol> finalLookAhead;
-			std::unordered_set<Symbol> checked;
-			while (!aheadStack.empty())
-			{
-				Symbol s = aheadStack.top();
-				checked.insert(s);
-				aheadStack.pop();
-				if (s.type == SymbolType::NONTERMINAL)
-				{
-					for (const Production& prodRule : m_grammar.getProductions())
-					{
-						if (prodRule.lhs == s)
-						{
-							if(prodRule.rhs.size() > 0)
-								if (checked.find(prodRule.rhs[0]) == checked.end())
-									aheadStack.push(prodRule.rhs[0]);
-							//for (const Symbol& ss : prodRule.rhs)
-						//		if(checked.find(ss) == checked.end())
-							//		aheadStack.push(ss);
-						}
-					}
-				}
-				else if (s.type == SymbolType::TERMINAL)
-				{
-					finalLookAhead.insert(s);
-				}
-			}
-			prod.lookAhead = finalLookAhead;
-		}
+		std::vector<int> depth(sets.size(), 0), stack;
+		for (int x = 0; x < (int)sets.size(); x++)
+			if (depth[x] == 0)
+				traverse(x, relation, sets, depth, stack);
 	}
 
-	std::vector<TrackedProduction> generateClosures(std::vector<TrackedProduction> prods, std::vector<TrackedProduction>* alreadyHad)
+	void traverse(int x, const std::vector<std::vector<int>>& relation, std::vector<TerminalSet>& sets, std::vector<int>& depth, std::vector<int>& stack)
 	{
-		std::vector<TrackedProduction>* closures = new std::vector<TrackedProduction>();
-		for (const TrackedProduction& production : prods)
+		stack.push_back(x);
+		int d = (int)stack.size();
+		depth[x] = d;
+		for (int y : relation[x])
+		{
+			if (depth[y] == 0)
+				traverse(y, relation, sets, depth, stack);
+			depth[x] = std::min(depth[x], depth[y]);
+			sets[x].unite(sets[y]);
+		}
+		if (depth[x] == d)
 		{
-			if (!production.isAtEnd())
+			while (true)
 			{
-				Symbol pointerSymbol = production.production.rhs[production.pointer];
-				//std::vector<Symbol> lookAheads = { production.nextSymbol() };
-				// TODO FIGURE OUT LOOK AHEADS AFTER MAKING CLOSURES
-				if (pointerSymbol.type == SymbolType::NONTERMINAL)
-				{
-					for (const Production& production : m_grammar.getProductions())
-					{
-						if (production.lhs == pointerSymbol)
-						{
-							TrackedProduction tracked = { production, 0, {} };
-							bool found = false;
-							for (TrackedProduction& prodFind : *alreadyHad)
-							{
-								if (prodFind == tracked)
-								{
-									found = true;
-									break;
-								}
-							}
-							if (!found)
-							{
-								alreadyHad->push_back(tracked);
-								std::vector<TrackedProduction> productions = generateClosures({ tracked }, alreadyHad);
-								closures->push_back(tracked);
-								closures->insert(closures->begin(), productions.begin(), productions.end());
-
-							}
-						}
-					}
-				}
+				int top = stack.back();
+				stack.pop_back();
+				depth[top] = INT_MAX;
+				if (top == x)
+					break;
+				sets[top] = sets[x];
 			}
 		}
-		std::vector<TrackedProduction> productions = *closures;
-		delete closures;
-		return productions;
 	}
 
 	void generateTypes()
@@ -764,8 +1772,21 @@ private:
 #define PARSER_LOCATION "C:/Dev/cpp/Pengo/Pengo/src/parser/"
 //#define PARSER_LOCATION "/"
 
-int main()
+// Peg.exe [-comb|-direct] [-tables file], -comb packs the tables with row displacement instead
+// of writing them dense, -direct writes the parser's loop out as code with a block per state.
+// -tables writes the tables to a file Pengo can load with -g instead of generating Parser.h
+int main(int argc, char* args[])
 {
+	TableLayout layout = TableLayout::Dense;
+	std::string tablesFile;
+	for (int i = 1; i < argc; i++)
+		if (std::string(args[i]) == "-comb")
+			layout = TableLayout::Comb;
+		else if (std::string(args[i]) == "-direct")
+			layout = TableLayout::Direct;
+		else if (std::string(args[i]) == "-tables" && i + 1 < argc)
+			tablesFile = args[++i];
+
 	/*
 	# Using EBNF to define context free grammar
 	# Implied whitespace between any terminal or nonterminal where apparent
@@ -867,10 +1888,10 @@ int main()
 
 	Grammar langGrammar(file);
 	langGrammar.addProduction({ file, {statements} });
-	langGrammar.addProduction({ statements, {statements, block} });
-	langGrammar.addProduction({ statements, {block} });
+	langGrammar.addProduction({ statements, {statements, block}, "appendBlock($1, $2)" });
+	langGrammar.addProduction({ statements, {block}, "buildStatements($1)" });
 
-	langGrammar.addProduction({ block, {{"{"}, statements, {"}"}} });
+	langGrammar.addProduction({ block, {{"{"}, statements, {"}"}}, "buildBlock($2)" });
 	langGrammar.addProduction({ block, {statement, {";"}} });
 	langGrammar.addProduction({ block, {ifStatement} });
 	langGrammar.addProduction({ block, {elseifStatement} });
@@ -878,35 +1899,48 @@ int main()
 	langGrammar.addProduction({ block, {whileStatement} });
 	langGrammar.addProduction({ block, {functionDeclareStatement} });
 
-	langGrammar.addProduction({ statement, {expression} });
+	langGrammar.addProduction({ statement, {expression}, "buildExpressionStatement($1)" });
 	//langGrammar.addProduction({ statement, {printStatement} });
 	langGrammar.addProduction({ statement, {varDeclareStatement} });
 	langGrammar.addProduction({ statement, {returnStatement} });
 
 	//langGrammar.addProduction({ printStatement, {{"Print"}, expression} });
-	langGrammar.addProduction({ functionDeclareStatement, {{"Func"}, identifier, {"("}, parameters, {")"}, block} });
-	langGrammar.addProduction({ parameters, {} });
-	langGrammar.addProduction({ parameters, {identifier, paramRecurse} });
-	langGrammar.addProduction({ paramRecurse, {} });
-	langGrammar.addProduction({ paramRecurse, {{","}, identifier, paramRecurse} });
-
-	langGrammar.addProduction({ returnStatement, {{"Return"}} });
-	langGrammar.addProduction({ returnStatement, {{"Return"}, expression}});
-	langGrammar.addProduction({ varDeclareStatement, {identifier, {"="}, expression} });
-	langGrammar.addProduction({ whileStatement, {{"While"}, {"("}, expression, {")"}, block} });
-	langGrammar.addProduction({ ifStatement, {{"If"}, {"("}, expression, {")"}, block}});
-	langGrammar.addProduction({ elseifStatement, {{"ElseIf"}, {"("}, expression, {")"}, block} });
-	langGrammar.addProduction({ elseStatement, {{"Else"}, block} });
+	langGrammar.addProduction({ functionDeclareStatement, {{"Func"}, identifier, {"("}, parameters, {")"}, block}, "buildFuncDeclare($2, $4, $6)" });
+	langGrammar.addProduction({ parameters, {}, "buildParams()" });
+	langGrammar.addProduction({ parameters, {identifier, paramRecurse}, "buildParams($1, $2)" });
+	langGrammar.addProduction({ paramRecurse, {}, "buildParams()" });
+	langGrammar.addProduction({ paramRecurse, {{","}, identifier, paramRecurse}, "buildParams($2, $3)" });
+
+	langGrammar.addProduction({ returnStatement, {{"Return"}}, "buildReturn()" });
+	langGrammar.addProduction({ returnStatement, {{"Return"}, expression}, "buildReturn($2)" });
+	langGrammar.addProduction({ varDeclareStatement, {identifier, {"="}, expression}, "buildVarDeclare($1, $3)" });
+	langGrammar.addProduction({ whileStatement, {{"While"}, {"("}, expression, {")"}, block}, "buildWhile($3, $5)" });
+	langGrammar.addProduction({ ifStatement, {{"If"}, {"("}, expression, {")"}, block}, "buildIf($3, $5, StatementType::If)" });
+	langGrammar.addProduction({ elseifStatement, {{"ElseIf"}, {"("}, expression, {")"}, block}, "buildIf($3, $5, StatementType::ElseIf)" });
+	langGrammar.addProduction({ elseStatement, {{"Else"}, block}, "buildElse($2)" });
+
+	// The operators are flat, precedence picks how they nest. Each level keeps its
+	// own node type so the tree comes out the same shape as the rules' names
+	langGrammar.addPrecedence(Associativity::Left, { "&&", "||" });
+	langGrammar.addPrecedence(Associativity::NonAssoc, { "==", "!=", ">", ">=", "<", "<=" });
+	langGrammar.addPrecedence(Associativity::Left, { "+", "-" });
+	langGrammar.addPrecedence(Associativity::Left, { "*", "/" });
+	langGrammar.addPrecedence(Associativity::Right, { "!" });
+	langGrammar.addPrecedence(Associativity::Left, { "(" });
 
 	langGrammar.addProduction({ expression, {logical} });
-
-	langGrammar.addProduction({logical, {logical, logicalOp, conditional}});
-	langGrammar.addProduction({ logical, {conditional } });
+	langGrammar.addProduction({ expression, {conditional} });
+	langGrammar.addProduction({ expression, {term} });
+	langGrammar.addProduction({ expression, {factor} });
+	langGrammar.addProduction({ expression, {unary} });
+	langGrammar.addProduction({ expression, {call} });
+	langGrammar.addProduction({ expression, {primary} });
+
+	langGrammar.addProduction({ logical, {expression, logicalOp, expression}, "buildLogical($1, $2, $3)", "&&" });
 	langGrammar.addProduction({ logicalOp, {{"&&"}} });
 	langGrammar.addProduction({ logicalOp, {{"||"}} });
 
-	langGrammar.addProduction({ conditional, {term, conditionalOp, term} });
-	langGrammar.addProduction({ conditional, {term} });
+	langGrammar.addProduction({ conditional, {expression, conditionalOp, expression}, "buildConditional($1, $2, $3)", "==" });
 	langGrammar.addProduction({ conditionalOp, {{"=="}} });
 	langGrammar.addProduction({ conditionalOp, {{"!="}} });
 	langGrammar.addProduction({ conditionalOp, {{">"}} });
@@ -914,37 +1948,33 @@ int main()
 	langGrammar.addProduction({ conditionalOp, {{"<"}} });
 	langGrammar.addProduction({ conditionalOp, {{"<="}} });
 
-	langGrammar.addProduction({ term, {term, termOp, factor} });
-	langGrammar.addProduction({ term, {factor} });
+	langGrammar.addProduction({ term, {expression, termOp, expression}, "buildBinary($1, $2, $3)", "+" });
 	langGrammar.addProduction({ termOp, {{"+"}} });
 	langGrammar.addProduction({ termOp, {{"-"}} });
 
-	langGrammar.addProduction({ factor, {factor, factorOp, unary} });
-	langGrammar.addProduction({ factor, {unary} });
+	langGrammar.addProduction({ factor, {expression, factorOp, expression}, "buildBinary($1, $2, $3)", "*" });
 	langGrammar.addProduction({ factorOp, {{"*"}} });
 	langGrammar.addProduction({ factorOp, {{"/"}} });
 
-	langGrammar.addProduction({ unary, {unaryOp, unary} });
-	langGrammar.addProduction({ unary, {call} });
+	langGrammar.addProduction({ unary, {unaryOp, expression}, "buildUnary($1, $2)", "!" });
 	langGrammar.addProduction({ unaryOp, {{"-"}}});
 	langGrammar.addProduction({ unaryOp, {{"!"}} });
 
-	langGrammar.addProduction({ call, {call, {"("}, arguments, {")"}} });
-	langGrammar.addProduction({ call, {primary} });
-	langGrammar.addProduction({ arguments, {} });
-	langGrammar.addProduction({ arguments, {expression, argRecurse} });
-	langGrammar.addProduction({ argRecurse, {} });
-	langGrammar.addProduction({ argRecurse, {{","}, expression, argRecurse} });
+	langGrammar.addProduction({ call, {expression, {"("}, arguments, {")"}}, "buildCall($1, $3)" });
+	langGrammar.addProduction({ arguments, {}, "buildArgs()" });
+	langGrammar.addProduction({ arguments, {expression, argRecurse}, "buildArgs($1, $2)" });
+	langGrammar.addProduction({ argRecurse, {}, "buildArgs()" });
+	langGrammar.addProduction({ argRecurse, {{","}, expression, argRecurse}, "buildArgs($2, $3)" });
 
-	langGrammar.addProduction({ primary, {identifier} });
+	langGrammar.addProduction({ primary, {identifier}, "buildVar($1)" });
 	langGrammar.addProduction({ primary, {grouping} });
 	langGrammar.addProduction({ primary, {lit} });
-	langGrammar.addProduction({ grouping, {{"("}, expression, {")"}} });
-	langGrammar.addProduction({ lit, {{"Integer"}} });
-	langGrammar.addProduction({ lit, {{"Float"}} });
-	langGrammar.addProduction({ lit, {{"String"}} });
+	langGrammar.addProduction({ grouping, {{"("}, expression, {")"}}, "std::move($2)" });
+	langGrammar.addProduction({ lit, {{"Integer"}}, "buildLiteral($1)" });
+	langGrammar.addProduction({ lit, {{"Float"}}, "buildLiteral($1)" });
+	langGrammar.addProduction({ lit, {{"String"}}, "buildLiteral($1)" });
 	langGrammar.addProduction({ identifier, {{"Identifier"}} });
-	langGrammar.addProduction({ lit, {{"Bool"}} });
+	langGrammar.addProduction({ lit, {{"Bool"}}, "buildLiteral($1)" });
 
 	/*
 	S -> N + N
@@ -979,9 +2009,13 @@ int main()
 	peg.addSubstitution(">=", "GreaterThanEqual");
 	peg.addSubstitution("<", "LessThan");
 	peg.addSubstitution("<=", "LessThanEqual");
+	peg.setSemanticActions("../AstBuilder.h", "SemanticValue");
 	peg.generateTables();
 	std::cin.get();
-	peg.generateParser(PARSER_LOCATION);
+	if (!tablesFile.empty())
+		peg.writeTables(tablesFile);
+	else
+		peg.generateParser(PARSER_LOCATION, layout);
 }
 
 /*
@@ -0,0 +1,183 @@
+#include "AstBuilder.h"
+#include "Collapse.h"
+
+#include <algorithm>
+
+template<typename T>
+static T take(SemanticValue& value)
+{
+	return std::move(std::get<T>(value));
+}
+
+SemanticValue buildStatements(SemanticValue& block)
+{
+	StatementList list;
+	appendStatement(list.statements, list.lastWasIf, take<std::unique_ptr<Statement>>(block));
+	return list;
+}
+
+SemanticValue appendBlock(SemanticValue& statements, SemanticValue& block)
+{
+	StatementList& list = std::get<StatementList>(statements);
+	appendStatement(list.statements, list.lastWasIf, take<std::unique_ptr<Statement>>(block));
+	return std::move(statements);
+}
+
+SemanticValue buildBlock(SemanticValue& statements)
+{
+	std::unique_ptr<BlockStatement> block = std::make_unique<BlockStatement>();
+	block->statements = std::move(std::get<StatementList>(statements).statements);
+	return std::unique_ptr<Statement>(std::move(block));
+}
+
+SemanticValue buildExpressionStatement(SemanticValue& exp)
+{
+	std::unique_ptr<ExpressionStatement> statement = std::make_unique<ExpressionStatement>();
+	statement->exp = take<std::unique_ptr<Expression>>(exp);
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildReturn()
+{
+	std::unique_ptr<ReturnStatement> statement = std::make_unique<ReturnStatement>();
+	statement->hasExp = false;
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildReturn(SemanticValue& exp)
+{
+	std::unique_ptr<ReturnStatement> statement = std::make_unique<ReturnStatement>();
+	statement->hasExp = true;
+	statement->exp = take<std::unique_ptr<Expression>>(exp);
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildVarDeclare(SemanticValue& name, SemanticValue& exp)
+{
+	std::unique_ptr<VarDeclareStatement> statement = std::make_unique<VarDeclareStatement>();
+	statement->name = take<Token>(name);
+	statement->exp = take<std::unique_ptr<Expression>>(exp);
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildWhile(SemanticValue& condition, SemanticValue& body)
+{
+	std::unique_ptr<WhileStatement> statement = std::make_unique<WhileStatement>();
+	statement->condition = take<std::unique_ptr<Expression>>(condition);
+	statement->body = wrapInBlock(take<std::unique_ptr<Statement>>(body), EnvironmentType::Loop);
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildIf(SemanticValue& condition, SemanticValue& body, StatementType type)
+{
+	std::unique_ptr<IfStatement> statement = std::make_unique<IfStatement>();
+	statement->condition = take<std::unique_ptr<Expression>>(condition);
+	statement->body = take<std::unique_ptr<Statement>>(body);
+	statement->hasElse = false;
+	statement->type = type;
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildElse(SemanticValue& body)
+{
+	std::unique_ptr<BlockStatement> statement = std::make_unique<BlockStatement>();
+	bool lastWasIf = false;
+	appendStatement(statement->statements, lastWasIf, take<std::unique_ptr<Statement>>(body));
+	statement->type = StatementType::Else;
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildFuncDeclare(SemanticValue& name, SemanticValue& params, SemanticValue& body)
+{
+	std::unique_ptr<FuncDeclareStatement> statement = std::make_unique<FuncDeclareStatement>();
+	statement->name = take<Token>(name);
+	statement->params = take<std::vector<Token>>(params);
+	std::reverse(statement->params.begin(), statement->params.end());
+	statement->body = wrapInBlock(take<std::unique_ptr<Statement>>(body), EnvironmentType::Function);
+	return std::unique_ptr<Statement>(std::move(statement));
+}
+
+SemanticValue buildParams()
+{
+	return std::vector<Token>();
+}
+
+SemanticValue buildParams(SemanticValue& param, SemanticValue& rest)
+{
+	std::get<std::vector<Token>>(rest).push_back(take<Token>(param));
+	return std::move(rest);
+}
+
+SemanticValue buildArgs()
+{
+	return std::vector<std::unique_ptr<Expression>>();
+}
+
+SemanticValue buildArgs(SemanticValue& arg, SemanticValue& rest)
+{
+	std::get<std::vector<std::unique_ptr<Expression>>>(rest).push_back(take<std::unique_ptr<Expression>>(arg));
+	return std::move(rest);
+}
+
+SemanticValue buildLogical(SemanticValue& left, SemanticValue& op, SemanticValue& right)
+{
+	std::unique_ptr<LogicalExpression> exp = std::make_unique<LogicalExpression>();
+	exp->left = take<std::unique_ptr<Expression>>(left);
+	exp->op = take<Token>(op);
+	exp->right = take<std::unique_ptr<Expression>>(right);
+	return std::unique_ptr<Expression>(std::move(exp));
+}
+
+SemanticValue buildConditional(SemanticValue& left, SemanticValue& op, SemanticValue& right)
+{
+	std::unique_ptr<ConditionalExpression> exp = std::make_unique<ConditionalExpression>();
+	exp->left = take<std::unique_ptr<Expression>>(left);
+	exp->op = take<Token>(op);
+	exp->right = take<std::unique_ptr<Expression>>(right);
+	return std::unique_ptr<Expression>(std::move(exp));
+}
+
+SemanticValue buildBinary(SemanticValue& left, SemanticValue& op, SemanticValue& right)
+{
+	std::unique_ptr<BinaryExpression> exp = std::make_unique<BinaryExpression>();
+	exp->left = take<std::unique_ptr<Expression>>(left);
+	exp->op = take<Token>(op);
+	exp->right = take<std::unique_ptr<Expression>>(right);
+	return std::unique_ptr<Expression>(std::move(exp));
+}
+
+SemanticValue buildUnary(SemanticValue& op, SemanticValue& exp)
+{
+	std::unique_ptr<UnaryExpression> unary = std::make_unique<UnaryExpression>();
+	unary->op = take<Token>(op);
+	unary->exp = take<std::unique_ptr<Expression>>(exp);
+	return std::unique_ptr<Expression>(std::move(unary));
+}
+
+SemanticValue buildCall(SemanticValue& callee, SemanticValue& args)
+{
+	std::unique_ptr<CallExpression> call = std::make_unique<CallExpression>();
+	call->callee = take<std::unique_ptr<Expression>>(callee);
+	call->args = take<std::vector<std::unique_ptr<Expression>>>(args);
+	std::reverse(call->args.begin(), call->args.end());
+	return std::unique_ptr<Expression>(std::move(call));
+}
+
+SemanticValue buildVar(SemanticValue& name)
+{
+	std::unique_ptr<VarExpression> var = std::make_unique<VarExpression>();
+	var->name = take<Token>(name);
+	return std::unique_ptr<Expression>(std::move(var));
+}
+
+SemanticValue buildLiteral(SemanticValue& token)
+{
+	std::unique_ptr<LiteralExpression> literal = std::make_unique<LiteralExpression>();
+	literal->value = literalValue(std::get<Token>(token));
+	return std::unique_ptr<Expression>(std::move(literal));
+}
+
+std::vector<std::unique_ptr<Statement>> takeStatements(SemanticValue& file)
+{
+	return std::move(std::get<StatementList>(file).statements);
+}
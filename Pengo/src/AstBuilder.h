@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ast\Expression.h"
+#include "ast\Statement.h"
+#include "tokenizer\Token.h"
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+// The statements of a file or block so far, elif and else statements are
+// attached to the if before them as they come in
+struct StatementList
+{
+	std::vector<std::unique_ptr<Statement>> statements;
+	bool lastWasIf = false;
+};
+
+// What the parser keeps on its value stack, a token for every shifted terminal
+// and whatever the rule's action built for every reduced one
+using SemanticValue = std::variant<std::monostate, Token, std::unique_ptr<Expression>, std::unique_ptr<Statement>,
+	StatementList, std::vector<Token>, std::vector<std::unique_ptr<Expression>>>;
+
+// The semantic actions of the grammar in Peg, each takes the values of its
+// rule's right hand side and moves out of them
+SemanticValue buildStatements(SemanticValue& block);
+SemanticValue appendBlock(SemanticValue& statements, SemanticValue& block);
+SemanticValue buildBlock(SemanticValue& statements);
+
+SemanticValue buildExpressionStatement(SemanticValue& exp);
+SemanticValue buildReturn();
+SemanticValue buildReturn(SemanticValue& exp);
+SemanticValue buildVarDeclare(SemanticValue& name, SemanticValue& exp);
+SemanticValue buildWhile(SemanticValue& condition, SemanticValue& body);
+SemanticValue buildIf(SemanticValue& condition, SemanticValue& body, StatementType type);
+SemanticValue buildElse(SemanticValue& body);
+SemanticValue buildFuncDeclare(SemanticValue& name, SemanticValue& params, SemanticValue& body);
+
+// Parameters and arguments are right recursive, so the lists are built back to
+// front and flipped by the function or call they end up in
+SemanticValue buildParams();
+SemanticValue buildParams(SemanticValue& param, SemanticValue& rest);
+SemanticValue buildArgs();
+SemanticValue buildArgs(SemanticValue& arg, SemanticValue& rest);
+
+SemanticValue buildLogical(SemanticValue& left, SemanticValue& op, SemanticValue& right);
+SemanticValue buildConditional(SemanticValue& left, SemanticValue& op, SemanticValue& right);
+SemanticValue buildBinary(SemanticValue& left, SemanticValue& op, SemanticValue& right);
+SemanticValue buildUnary(SemanticValue& op, SemanticValue& exp);
+SemanticValue buildCall(SemanticValue& callee, SemanticValue& args);
+SemanticValue buildVar(SemanticValue& name);
+SemanticValue buildLiteral(SemanticValue& token);
+
+// The statements of a whole file once the parser accepts
+std::vector<std::unique_ptr<Statement>> takeStatements(SemanticValue& file);
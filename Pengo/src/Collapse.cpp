@@ -2,13 +2,69 @@
 #include <stack>
 #include <queue>
 #include <type_traits>
+#include <iostream>
 
-std::vector<std::unique_ptr<Statement>> collapseParseTree(const Node* root)
+static std::vector<std::unique_ptr<Statement>> deriveStatements(const ParseTree& tree, const Node* root);
+static std::unique_ptr<Statement> deriveStatement(const ParseTree& tree, const Node& root);
+static std::unique_ptr<Expression> deriveExpression(const ParseTree& tree, const Node& root);
+static Token deriveToken(const ParseTree& tree, const Node& root);
+
+std::vector<std::unique_ptr<Statement>> collapseParseTree(const ParseTree& tree)
+{
+	return deriveStatements(tree, &tree.root());
+}
+
+std::unique_ptr<Statement> collapseBlock(const ParseTree& tree, const Node& block)
+{
+	return deriveStatement(tree, block);
+}
+
+bool appendStatement(std::vector<std::unique_ptr<Statement>>& statements, bool& lastWasIf, std::unique_ptr<Statement> stmt)
+{
+	bool tLastWas = lastWasIf;
+	lastWasIf = stmt->type == StatementType::If || stmt->type == StatementType::ElseIf;
+	if (stmt->type == StatementType::ElseIf || stmt->type == StatementType::Else)
+	{
+		if (tLastWas)
+		{
+			IfStatement* currentIf = (IfStatement*)statements[statements.size() - 1].get();
+			while (currentIf->hasElse && currentIf->elze->type == StatementType::ElseIf)
+				currentIf = (IfStatement*)currentIf->elze.get();
+			currentIf->elze = std::move(stmt);
+			currentIf->hasElse = true;
+		}
+		else
+		{
+			// DISPLAY ERROR
+			// A dropped elif must not let an else after it attach to whatever came before
+			lastWasIf = false;
+		}
+		return false;
+	}
+	statements.push_back(std::move(stmt));
+	return true;
+}
+
+std::unique_ptr<Statement> wrapInBlock(std::unique_ptr<Statement> statement, EnvironmentType envType)
+{
+	if (statement->type != StatementType::Block)
+	{
+		std::unique_ptr<BlockStatement> block = std::make_unique<BlockStatement>();
+		block->statements.push_back(std::move(statement));
+		statement = std::move(block);
+	}
+	((BlockStatement*)statement.get())->envType = envType;
+	return statement;
+}
+
+// Only tables loaded with -g can build a tree the cases below don't expect
+[[noreturn]] static void unexpectedNode()
 {
-	return deriveStatements(root);
+	std::cout << "The parse tree has a node the interpreter does not expect" << std::endl;
+	exit(-2);
 }
 
-static std::vector<std::unique_ptr<Statement>> deriveStatements(const Node* root)
+static std::vector<std::unique_ptr<Statement>> deriveStatements(const ParseTree& tree, const Node* root)
 {
 	std::vector<std::unique_ptr<Statement>> statements;
 	std::stack<const Node*> stack;
@@ -18,99 +74,84 @@ static std::vector<std::unique_ptr<Statement>> deriveStatements(const Node* root
 	{
 		const Node* next = stack.top();
 		stack.pop();
-		if (next->type == NodeType::Block)
-		{
-			std::unique_ptr<Statement> stmt = std::move(deriveStatement(*next));
-			bool tLastWas = lastWasIf;
-			lastWasIf = stmt->type == StatementType::If || stmt->type == StatementType::ElseIf;
-			if (stmt->type == StatementType::ElseIf || stmt->type == StatementType::Else)
-			{
-				if (tLastWas)
-				{
-					IfStatement* currentIf = (IfStatement*)statements[statements.size() - 1].get();
-					while (currentIf->hasElse && currentIf->elze->type == StatementType::ElseIf)
-						currentIf = (IfStatement*)currentIf->elze.get();
-					currentIf->elze = std::move(stmt);
-					currentIf->hasElse = true;
-				}
-				else
-				{
-					// DISPLAY ERROR
-				}
-			}
-			else statements.push_back(std::move(stmt));
-		}
+		// Blocks that were a single statement rule show up as that statement
+		if (next->type != NodeType::Statements)
+			appendStatement(statements, lastWasIf, deriveStatement(tree, *next));
 		else
 		{
-			std::vector<Node*> tChildren;
-			for (const Node& child : next->children)
-				tChildren.push_back((Node*) &child);
-			std::reverse(tChildren.begin(), tChildren.end());
-			for (Node* child : tChildren)
-				stack.push(child);
+			std::span<const Node> children = tree.children(*next);
+			for (auto child = children.rbegin(); child != children.rend(); child++)
+				stack.push(&*child);
 		}
 	}
 	return statements;
 }
 
-static std::unique_ptr<Statement> deriveStatement(const Node& root)
+static std::unique_ptr<Statement> deriveStatement(const ParseTree& tree, const Node& root)
 {
+	std::span<const Node> children = tree.children(root);
 	switch (root.type)
 	{
 	case NodeType::ReturnStatement:
 	{
 		ReturnStatement returnStatement;
-		returnStatement.hasExp = root.children.size() == 1;
+		returnStatement.hasExp = root.count == 1;
 		if(returnStatement.hasExp)
-			returnStatement.exp = deriveExpression(root.children[0]);
+			returnStatement.exp = deriveExpression(tree, children[0]);
 		return std::make_unique<ReturnStatement>(std::move(returnStatement));
 	}
 	break;
 	case NodeType::FunctionDeclareStatement:
 	{
+		if (root.count < 3)
+			unexpectedNode();
 		FuncDeclareStatement funcStatement;
-		funcStatement.name = deriveToken(root.children[0]);
+		funcStatement.name = deriveToken(tree, children[0]);
 		std::stack<const Node*> stack;
-		stack.push(&(root.children[1]));
+		stack.push(&(children[1]));
 		while (!stack.empty())
 		{
 			const Node* next = stack.top();
 			stack.pop();
-			if (next->type == NodeType::Identifier)
-				funcStatement.params.push_back(next->token);
+			if (next->type == NodeType::Identifier && next->terminal)
+				funcStatement.params.push_back(tree.token(*next));
 			else
-				for (const Node& child : next->children)
+				for (const Node& child : tree.children(*next))
 					stack.push(&child);
 		}
 		std::reverse(funcStatement.params.begin(), funcStatement.params.end());
-		funcStatement.body = std::move(deriveStatement(root.children[2]));
-		((BlockStatement*)funcStatement.body.get())->envType = EnvironmentType::Function;
+		funcStatement.body = wrapInBlock(deriveStatement(tree, children[2]), EnvironmentType::Function);
 		return std::make_unique<FuncDeclareStatement>(std::move(funcStatement));
 	}
 	break;
 	case NodeType::WhileStatement:
 	{
+		if (root.count < 2)
+			unexpectedNode();
 		WhileStatement whileStatement;
-		whileStatement.condition = deriveExpression(root.children[0]);
-		whileStatement.body = deriveStatement(root.children[1]);
-		((BlockStatement*)whileStatement.body.get())->envType = EnvironmentType::Loop;
+		whileStatement.condition = deriveExpression(tree, children[0]);
+		whileStatement.body = wrapInBlock(deriveStatement(tree, children[1]), EnvironmentType::Loop);
 		return std::make_unique<WhileStatement>(std::move(whileStatement));
 	}
 	break;
 	case NodeType::IfStatement:
 	{
+		if (root.count < 2)
+			unexpectedNode();
 		IfStatement ifStatement;
-		ifStatement.condition = deriveExpression(root.children[0]);
-		ifStatement.body = deriveStatement(root.children[1]);
+		ifStatement.condition = deriveExpression(tree, children[0]);
+		ifStatement.body = deriveStatement(tree, children[1]);
 		ifStatement.hasElse = false;
 		return std::make_unique<IfStatement>(std::move(ifStatement));
 	}
 	break;
 	case NodeType::ElseIfStatement:
 	{
+		if (root.count < 2)
+			unexpectedNode();
 		IfStatement ifStatement;
-		ifStatement.condition = deriveExpression(root.children[0]);
-		ifStatement.body = deriveStatement(root.children[1]);
+		ifStatement.condition = deriveExpression(tree, children[0]);
+		ifStatement.body = deriveStatement(tree, children[1]);
 		ifStatement.hasElse = false;
 		ifStatement.type = StatementType::ElseIf;
 		return std::make_unique<IfStatement>(std::move(ifStatement));
@@ -118,141 +159,167 @@ static std::unique_ptr<Statement> deriveStatement(const Node& root)
 	break;
 	case NodeType::ElseStatement:
 	{
+		if (root.count < 1)
+			unexpectedNode();
 		BlockStatement elseStatement;
-		elseStatement.statements = deriveStatements(&root.children[0]);
+		elseStatement.statements = deriveStatements(tree, &children[0]);
 		elseStatement.type = StatementType::Else;
 		return std::make_unique<BlockStatement>(std::move(elseStatement));
 	}
 	break;
 	case NodeType::Block:
 	{
-		if (root.children[0].type == NodeType::Statement)
-		{
-			return deriveStatement(root.children[0].children[0]);
-		}
-		else if (root.children[0].type == NodeType::Statements)
+		if (root.count < 1)
+			unexpectedNode();
+		if (children[0].type == NodeType::Statements)
 		{
 			BlockStatement blockStatement;
-			blockStatement.statements = deriveStatements(&root.children[0]);
+			blockStatement.statements = deriveStatements(tree, &children[0]);
 			return std::make_unique<BlockStatement>(std::move(blockStatement));
 		}
 		else
 		{
-			return deriveStatement(root.children[0]);
+			return deriveStatement(tree, children[0]);
 		}
 	}
 	break;
-	case NodeType::Expression:
+	case NodeType::Statement:
 	{
+		if (root.count < 1)
+			unexpectedNode();
 		ExpressionStatement expStatement;
-		expStatement.exp = deriveExpression(root.children[0]);
+		expStatement.exp = deriveExpression(tree, children[0]);
 		return std::make_unique<ExpressionStatement>(std::move(expStatement));
 	}
 	break;
 	/*case NodeType::PrintStatement:
 	{
 		PrintStatement printStatement;
-		printStatement.exp = deriveExpression(root.children[0]);
+		printStatement.exp = deriveExpression(tree, children[0]);
 		return std::make_unique<PrintStatement>(std::move(printStatement));
 	}
 	break;*/
 	case NodeType::VarDeclareStatement:
 	{
+		if (root.count < 2)
+			unexpectedNode();
 		VarDeclareStatement varDeclareStatement;
-		varDeclareStatement.name = deriveToken(root.children[0]);
-		varDeclareStatement.exp = deriveExpression(root.children[1]);
+		varDeclareStatement.name = deriveToken(tree, children[0]);
+		varDeclareStatement.exp = deriveExpression(tree, children[1]);
 		return std::make_unique<VarDeclareStatement>(std::move(varDeclareStatement));
 	}
 	break;
 	}
+	unexpectedNode();
 }
 
-static std::unique_ptr<Expression> deriveExpression(const Node& root)
+static std::unique_ptr<Expression> deriveExpression(const ParseTree& tree, const Node& root)
 {
+	std::span<const Node> children = tree.children(root);
 	switch (root.type)
 	{
 	case NodeType::Logical:
-		if (root.children.size() == 3)
+		if (root.count == 3)
 		{
 			LogicalExpression exp;
-			exp.left = deriveExpression(root.children[0]);
-			exp.op = deriveToken(root.children[1]);
-			exp.right = deriveExpression(root.children[2]);
+			exp.left = deriveExpression(tree, children[0]);
+			exp.op = deriveToken(tree, children[1]);
+			exp.right = deriveExpression(tree, children[2]);
 			return std::make_unique<LogicalExpression>(std::move(exp));
 		}
 		break;
 	case NodeType::Conditional:
-		if (root.children.size() == 3)
+		if (root.count == 3)
 		{
 			ConditionalExpression exp;
-			exp.left = deriveExpression(root.children[0]);
-			exp.op = deriveToken(root.children[1]);
-			exp.right = deriveExpression(root.children[2]);
+			exp.left = deriveExpression(tree, children[0]);
+			exp.op = deriveToken(tree, children[1]);
+			exp.right = deriveExpression(tree, children[2]);
 			return std::make_unique<ConditionalExpression>(std::move(exp));
 		}
 		break;
 	case NodeType::Call:
-		if (root.children.size() == 2) {
+		if (root.count == 2) {
 			CallExpression callExp;
-			callExp.callee = deriveExpression(root.children[0]);
+			callExp.callee = deriveExpression(tree, children[0]);
 			std::stack<const Node*> stack;
-			stack.push(&(root.children[1]));
+			stack.push(&(children[1]));
 			while (!stack.empty())
 			{
 				const Node* next = stack.top();
 				stack.pop();
-				if (next->type == NodeType::Expression)
-					callExp.args.push_back(std::move(deriveExpression(*next)));
-				else
-					for (const Node& child : next->children)
+				if (next->type == NodeType::Arguments || next->type == NodeType::ArgRecurse)
+					for (const Node& child : tree.children(*next))
 						stack.push(&child);
+				else
+					callExp.args.push_back(std::move(deriveExpression(tree, *next)));
 			}
 			std::reverse(callExp.args.begin(), callExp.args.end());
 			return std::make_unique<CallExpression>(std::move(callExp));
 		}
 		break;
 	case NodeType::Unary:
-		if (root.children.size() == 2)
+		if (root.count == 2)
 		{
 			UnaryExpression exp;
-			exp.op = deriveToken(root.children[0]);
-			exp.exp = deriveExpression(root.children[1]);
+			exp.op = deriveToken(tree, children[0]);
+			exp.exp = deriveExpression(tree, children[1]);
 			return std::make_unique<UnaryExpression>(std::move(exp));
 		}
 		break;
 	case NodeType::Term:
 	case NodeType::Factor:
-		if (root.children.size() == 3)
+		if (root.count == 3)
 		{
 			BinaryExpression exp;
-			exp.left = deriveExpression(root.children[0]);
-			exp.op = deriveToken(root.children[1]);
-			exp.right = deriveExpression(root.children[2]);
+			exp.left = deriveExpression(tree, children[0]);
+			exp.op = deriveToken(tree, children[1]);
+			exp.right = deriveExpression(tree, children[2]);
 			return std::make_unique<BinaryExpression>(std::move(exp));
 		}
 		break;
 	case NodeType::Literal:
 	{
+		if (!root.terminal)
+			unexpectedNode();
 		LiteralExpression exp;
-		exp.value = root.token;
-		return std::make_unique<LiteralExpression>(exp);
+		exp.value = literalValue(tree.token(root));
+		return std::make_unique<LiteralExpression>(std::move(exp));
 	}
 	break;
 	case NodeType::Identifier:
 	{
+		if (!root.terminal)
+			unexpectedNode();
 		VarExpression varExpression;
-		varExpression.name = root.token;
+		varExpression.name = tree.token(root);
 		return std::make_unique<VarExpression>(std::move(varExpression));
 	}
 	break;
 	}
-	return deriveExpression(root.children[0]);
+	if (root.count == 0)
+		unexpectedNode();
+	return deriveExpression(tree, children[0]);
 }
 
-static Token deriveToken(const Node& root)
+static Token deriveToken(const ParseTree& tree, const Node& root)
 {
 	if (root.terminal)
-		return root.token;
+		return tree.token(root);
+	else if (root.count == 0)
+		unexpectedNode();
 	else
-		return deriveToken(root.children[0]);
+		return deriveToken(tree, tree.children(root)[0]);
+}
+
+Value literalValue(const Token& token)
+{
+	switch (token.type)
+	{
+	case TokenType::Integer: return { ValueType::Integer, token.integer };
+	case TokenType::Float: return { ValueType::Float, token.decimal };
+	case TokenType::String: return { ValueType::String, std::string(token.token) };
+	case TokenType::Bool: return { ValueType::Bool, token.boolean };
+	default: return { ValueType::Null, {} };
+	}
 }
\ No newline at end of file
@@ -7,9 +7,12 @@
 #include "parser\Parser.h"
 #include <vector>
 
-std::vector<std::unique_ptr<Statement>> collapseParseTree(const Node* root);
-
-static std::vector<std::unique_ptr<Statement>> deriveStatements(const Node* root);
-static std::unique_ptr<Statement> deriveStatement(const Node& root);
-static std::unique_ptr<Expression> deriveExpression(const Node& root);
-static Token deriveToken(const Node& root);
\ No newline at end of file
+std::vector<std::unique_ptr<Statement>> collapseParseTree(const ParseTree& tree);
+// For collapsing top level blocks one at a time
+std::unique_ptr<Statement> collapseBlock(const ParseTree& tree, const Node& block);
+// Elif and else statements are attached to the if before them instead of being
+// appended, returns whether the statement was appended
+bool appendStatement(std::vector<std::unique_ptr<Statement>>& statements, bool& lastWasIf, std::unique_ptr<Statement> statement);
+// Function and loop bodies that are a single statement are put in a block of their own
+std::unique_ptr<Statement> wrapInBlock(std::unique_ptr<Statement> statement, EnvironmentType envType);
+Value literalValue(const Token& token);
\ No newline at end of file
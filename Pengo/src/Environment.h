@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ast/Value.h"
+#include "tokenizer/SymbolTable.h"
+#include "tokenizer/LineIndex.h"
 #include <string>
 #include <unordered_map>
 #include <iostream>
@@ -18,8 +20,8 @@ enum class EnvironmentType
 struct Environment
 {
 	EnvironmentType type = EnvironmentType::Generic;
-	std::unordered_map<std::string, Value> m_variables;
-	std::unordered_map<std::string, std::shared_ptr<Function>> m_functions;
+	std::unordered_map<Atom, Value> m_variables;
+	std::unordered_map<Atom, std::shared_ptr<Function>> m_functions;
 
 	bool stop = false;
 	Value returnVal; // Used only for functions, too lazy to create a whole OOP environment its literally 11 pm lmao
@@ -29,20 +31,22 @@ struct Environment
 		
 	}
 
-	bool hasVariable(const std::string& name) 
+	bool hasVariable(Atom name) 
 	{
 		return m_variables.find(name) != m_variables.end();
 	}
 
 	Value& getVariable(const Token& token) 
 	{
-		if (hasVariable(token.token))
+		auto it = m_variables.find(token.atom);
+		if (it != m_variables.end())
 		{
-			return m_variables.at(token.token);
+			return it->second;
 		}
 		else
 		{
-			std::cout << "Error at (" << token.line << ":" << token.pos << "):" << std::endl;
+			LineIndex::Location at = LineIndex::script().locate(token.offset);
+			std::cout << "Error at (" << at.line << ":" << at.pos << "):" << std::endl;
 			std::cout << "Variable " << token.token << " not defined" << std::endl;
 			exit(-2);
 		}
@@ -4,6 +4,8 @@
 #include <memory>
 #include <iostream>
 
+#include "tokenizer/SymbolTable.h"
+
 #define FUN_PRINT "print"
 #define FUN_PRINTLN "println"
 #define FUN_INPUT "input"
@@ -24,11 +26,11 @@ struct Function
 
 struct UserFunction : public Function
 {
-	UserFunction(int args, std::vector<std::string> params, std::shared_ptr<Statement> body) :
+	UserFunction(int args, std::vector<Atom> params, std::shared_ptr<Statement> body) :
 		body(std::move(body)),
 		params(params)
 	{ builtIn = false; this->args = args; }
-	std::vector<std::string> params;
+	std::vector<Atom> params;
 	std::shared_ptr<Statement> body;
 	Value call(Interpreter& interpreter, std::vector<Value> values);
 };
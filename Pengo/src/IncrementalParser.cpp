@@ -0,0 +1,341 @@
+#include "IncrementalParser.h"
+#include "Collapse.h"
+
+#include <algorithm>
+#include <iostream>
+
+// Past this many live versions of the text the whole source is parsed again so
+// the old copies can be freed
+#define MAX_SOURCE_VERSIONS 32
+
+// Moves every token of an unchanged statement along by the bytes an edit added before it
+class OffsetShifter : private Expression::Visitor, private Statement::Visitor
+{
+public:
+	OffsetShifter(ptrdiff_t delta) : m_delta(delta) { }
+
+	inline void shift(Statement& statement) { statement.accept(*this); }
+private:
+	ptrdiff_t m_delta;
+
+	inline void shift(Token& token) { token.offset += (int)m_delta; }
+	inline void shift(const std::unique_ptr<Expression>& expression) { expression->accept(*this); }
+
+	Value visitLogical(LogicalExpression* expression)
+	{
+		shift(expression->left);
+		shift(expression->op);
+		shift(expression->right);
+		return {};
+	}
+	Value visitConditional(ConditionalExpression* expression)
+	{
+		shift(expression->left);
+		shift(expression->op);
+		shift(expression->right);
+		return {};
+	}
+	Value visitUnary(UnaryExpression* expression)
+	{
+		shift(expression->op);
+		shift(expression->exp);
+		return {};
+	}
+	Value visitCall(CallExpression* expression)
+	{
+		shift(expression->callee);
+		for (const std::unique_ptr<Expression>& arg : expression->args)
+			shift(arg);
+		return {};
+	}
+	Value visitBinary(BinaryExpression* expression)
+	{
+		shift(expression->left);
+		shift(expression->op);
+		shift(expression->right);
+		return {};
+	}
+	Value visitLiteral(LiteralExpression*) { return {}; }
+	Value visitVar(VarExpression* expression)
+	{
+		shift(expression->name);
+		return {};
+	}
+
+	void visitReturn(ReturnStatement* statement)
+	{
+		if (statement->hasExp)
+			shift(statement->exp);
+	}
+	void visitFuncDeclare(FuncDeclareStatement* statement)
+	{
+		shift(statement->name);
+		for (Token& param : statement->params)
+			shift(param);
+		shift(*statement->body);
+	}
+	void visitWhile(WhileStatement* statement)
+	{
+		shift(statement->condition);
+		shift(*statement->body);
+	}
+	void visitIf(IfStatement* statement)
+	{
+		shift(statement->condition);
+		shift(*statement->body);
+		if (statement->hasElse)
+			shift(*statement->elze);
+	}
+	void visitBlock(BlockStatement* statement)
+	{
+		for (const std::unique_ptr<Statement>& inner : statement->statements)
+			shift(*inner);
+	}
+	void visitExpression(ExpressionStatement* statement) { shift(statement->exp); }
+	void visitPrint(PrintStatement* statement) { shift(statement->exp); }
+	void visitVarDeclare(VarDeclareStatement* statement)
+	{
+		shift(statement->name);
+		shift(statement->exp);
+	}
+};
+
+static void shiftOffsets(ParseTree& tree, ptrdiff_t delta)
+{
+	for (Token& token : tree.tokens)
+		token.offset += (int)delta;
+}
+
+IncrementalParser::IncrementalParser(std::string source)
+{
+	m_source = std::make_shared<Source>();
+	m_source->text = std::move(source);
+	m_source->tokenizer = std::make_unique<Tokenizer>(m_source->text);
+	parseAll();
+}
+
+void IncrementalParser::edit(size_t offset, size_t length, std::string_view text)
+{
+	std::string_view old = m_source->text;
+	ptrdiff_t delta = (ptrdiff_t)text.size() - (ptrdiff_t)length;
+
+	std::shared_ptr<Source> source = std::make_shared<Source>();
+	source->text.reserve(old.size() + delta);
+	source->text.append(old.substr(0, offset)).append(text).append(old.substr(offset + length));
+	source->tokenizer = std::make_unique<Tokenizer>(source->text);
+	m_source = source;
+
+	// A block ends with a ; or } so text right after it can never join it
+	size_t first = std::partition_point(m_blocks.begin(), m_blocks.end(),
+		[&](const TopLevelBlock& block) { return block.end <= offset; }) - m_blocks.begin();
+	bool firstContinued = first < m_blocks.size() && continuesStatement(first);
+
+	size_t resume;
+	std::vector<TopLevelBlock> parsed = parseBlocks(first, offset + text.size(), delta, resume);
+	m_reparsedBlocks = parsed.size();
+
+	// The rest of the blocks are the same text further along
+	for (size_t i = resume; i < m_blocks.size(); i++)
+	{
+		m_blocks[i].end += delta;
+		m_blocks[i].shift += delta;
+	}
+	ptrdiff_t blockShift = (ptrdiff_t)parsed.size() - (ptrdiff_t)(resume - first);
+	m_blocks.erase(m_blocks.begin() + first, m_blocks.begin() + resume);
+	m_blocks.insert(m_blocks.begin() + first, std::make_move_iterator(parsed.begin()), std::make_move_iterator(parsed.end()));
+
+	// Re-collapse whole if chains, the statement before has to be redone when an
+	// elif or else was added to or removed from it
+	size_t from = first;
+	if (firstContinued || (first < m_blocks.size() && continuesStatement(first)))
+		while (from > 0 && (from == first || continuesStatement(from)))
+			from--;
+	size_t to = first + parsed.size();
+	while (to < m_blocks.size() && continuesStatement(to))
+		to++;
+	collapse(from, to, blockShift, delta);
+
+	m_versions.erase(std::remove_if(m_versions.begin(), m_versions.end(),
+		[](const std::weak_ptr<Source>& version) { return version.expired(); }), m_versions.end());
+	m_versions.push_back(m_source);
+	if (m_versions.size() > MAX_SOURCE_VERSIONS)
+		parseAll();
+}
+
+void IncrementalParser::parseAll()
+{
+	m_blocks.clear();
+	m_statements.clear();
+	m_statementBlocks.clear();
+	m_versions = { m_source };
+
+	size_t resume;
+	m_blocks = parseBlocks(0, 0, 0, resume);
+	collapse(0, m_blocks.size(), 0, 0);
+	m_reparsedBlocks = m_blocks.size();
+}
+
+ParseTree IncrementalParser::tree() const
+{
+	// Statements is left recursive, so the blocks hang off a left leaning spine
+	ParseTree file;
+	Node statements;
+	for (size_t i = 0; i < m_blocks.size(); i++)
+	{
+		// The block's arena is appended with its indices moved past what is there
+		const ParseTree& block = m_blocks[i].tree;
+		uint32_t nodeBase = (uint32_t)file.nodes.size(), tokenBase = (uint32_t)file.tokens.size();
+		for (Node node : block.nodes)
+		{
+			node.index += node.terminal ? tokenBase : nodeBase;
+			file.nodes.push_back(node);
+		}
+		for (Token token : block.tokens)
+		{
+			token.offset += (int)m_blocks[i].shift;
+			file.tokens.push_back(token);
+		}
+		// Its root becomes the last child of the next Statements
+		Node root = file.nodes.back();
+		file.nodes.pop_back();
+		Node next;
+		next.type = NodeType::Statements;
+		next.index = (uint32_t)file.nodes.size();
+		if (i > 0)
+			file.nodes.push_back(statements);
+		file.nodes.push_back(root);
+		next.count = (uint32_t)file.nodes.size() - next.index;
+		statements = next;
+	}
+	// File only passes the Statements through
+	file.nodes.push_back(statements);
+	return file;
+}
+
+std::vector<IncrementalParser::TopLevelBlock> IncrementalParser::parseBlocks(size_t first, size_t editEnd, ptrdiff_t delta, size_t& resume)
+{
+	const std::string& text = m_source->text;
+	Tokenizer& tokenizer = *m_source->tokenizer;
+	int statementsState = m_parser.gotoState(0, NodeType::Statements);
+
+	// Between top level blocks the stack is always the start state, with the
+	// Statements parsed so far on top of it after the first block
+	std::vector<int> stack = { 0 };
+	if (first > 0)
+	{
+		tokenizer.seek((int)m_blocks[first - 1].end);
+		stack.push_back(statementsState);
+	}
+	else
+		tokenizer.seek(0);
+
+	std::vector<TopLevelBlock> parsed;
+	ParseTree tree;
+	std::vector<Node> output;
+	size_t old = first;
+	Token current = tokenizer.next();
+	Token beforeToken = current;
+	while (true)
+	{
+		const Action& nextAction = m_parser.action(stack.back(), current.type);
+		if (nextAction.type == ActionType::None)
+		{
+			LineIndex::Location at = LineIndex(text).locate(current.offset);
+			if (current.type == TokenType::_EOF)
+				std::cout << "Unexpected end of file at line " << at.line << " at pos " << at.pos << std::endl;
+			else
+				std::cout << "Error parsing line " << at.line << " at pos " << at.pos << std::endl;
+			exit(-2);
+		}
+		else if (nextAction.type == ActionType::Shift)
+		{
+			beforeToken = current;
+			current = tokenizer.next();
+			stack.push_back(nextAction.value);
+		}
+		else if (nextAction.type == ActionType::Reduce)
+		{
+			const Production& production = m_parser.production(nextAction.value);
+			stack.resize(stack.size() - production.rhs);
+			bool startOfBlock = stack.size() == 1 || (stack.size() == 2 && stack[1] == statementsState);
+			stack.push_back(m_parser.gotoState(stack.back(), production.lhs));
+			// The top level blocks are kept in a list instead of the Statements spine
+			if (startOfBlock && (production.lhs == NodeType::Statements || production.lhs == NodeType::File))
+				continue;
+			tree.reduce(output, production, beforeToken);
+			if (!startOfBlock || production.lhs != NodeType::Block)
+				continue;
+
+			// The block is the only thing on the output stack, it is done once its root is in
+			tree.nodes.push_back(output.back());
+			output.pop_back();
+			// The last token of a block is always its ; or }
+			size_t end = beforeToken.offset;
+			parsed.push_back({ std::move(tree), m_source, end });
+			tree = ParseTree();
+
+			// Once the block ends line up past the edit the old blocks after are the
+			// same text, only further along
+			if (end >= editEnd)
+			{
+				size_t oldEnd = (size_t)((ptrdiff_t)end - delta);
+				while (old < m_blocks.size() && m_blocks[old].end < oldEnd)
+					old++;
+				if (old < m_blocks.size() && m_blocks[old].end == oldEnd)
+				{
+					resume = old + 1;
+					return parsed;
+				}
+			}
+		}
+		else if (nextAction.type == ActionType::Accept)
+		{
+			break;
+		}
+	}
+	resume = m_blocks.size();
+	return parsed;
+}
+
+void IncrementalParser::collapse(size_t from, size_t to, ptrdiff_t blockShift, ptrdiff_t delta)
+{
+	// The statements are still numbered by the old blocks
+	size_t oldTo = (size_t)((ptrdiff_t)to - blockShift);
+	size_t begin = std::lower_bound(m_statementBlocks.begin(), m_statementBlocks.end(), from) - m_statementBlocks.begin();
+	size_t end = std::lower_bound(m_statementBlocks.begin(), m_statementBlocks.end(), oldTo) - m_statementBlocks.begin();
+
+	for (size_t i = end; i < m_statements.size(); i++)
+	{
+		m_statementBlocks[i] += blockShift;
+		if (delta != 0)
+			OffsetShifter(delta).shift(*m_statements[i]);
+	}
+
+	std::vector<std::unique_ptr<Statement>> statements;
+	std::vector<size_t> statementBlocks;
+	bool lastWasIf = false;
+	for (size_t i = from; i < to; i++)
+	{
+		TopLevelBlock& block = m_blocks[i];
+		if (block.shift != 0)
+		{
+			shiftOffsets(block.tree, block.shift);
+			block.shift = 0;
+		}
+		if (appendStatement(statements, lastWasIf, collapseBlock(block.tree, block.tree.root())))
+			statementBlocks.push_back(i);
+	}
+	m_recollapsedStatements = statements.size();
+
+	m_statements.erase(m_statements.begin() + begin, m_statements.begin() + end);
+	m_statements.insert(m_statements.begin() + begin, std::make_move_iterator(statements.begin()), std::make_move_iterator(statements.end()));
+	m_statementBlocks.erase(m_statementBlocks.begin() + begin, m_statementBlocks.begin() + end);
+	m_statementBlocks.insert(m_statementBlocks.begin() + begin, statementBlocks.begin(), statementBlocks.end());
+}
+
+bool IncrementalParser::continuesStatement(size_t block) const
+{
+	// Their Block rule passes them through, so they are the root themselves
+	NodeType type = m_blocks[block].tree.root().type;
+	return type == NodeType::ElseIfStatement || type == NodeType::ElseStatement;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "ast\Statement.h"
+#include "parser\Parser.h"
+#include "tokenizer\Tokenizer.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Keeps the parse of a source between edits for editor style re-runs. An edit
+// re-tokenizes from the end of the top level block before it, runs the parser
+// from the state it has between top level blocks until the blocks line up with
+// the old ones again, and only re-collapses the top level statements it touched.
+class IncrementalParser
+{
+public:
+	IncrementalParser(std::string source);
+
+	// Replaces length bytes at offset with text
+	void edit(size_t offset, size_t length, std::string_view text);
+
+	inline const std::string& source() const { return m_source->text; }
+	inline const std::vector<std::unique_ptr<Statement>>& statements() const { return m_statements; }
+	// The same tree Parser::parse gives for the whole source
+	ParseTree tree() const;
+
+	inline size_t blockCount() const { return m_blocks.size(); }
+	// How much the last edit had to redo
+	inline size_t reparsedBlocks() const { return m_reparsedBlocks; }
+	inline size_t recollapsedStatements() const { return m_recollapsedStatements; }
+private:
+	// One version of the source, blocks parsed from it keep it alive because
+	// their tokens point into its text and into the tokenizer's decoded strings
+	struct Source
+	{
+		std::string text;
+		std::unique_ptr<Tokenizer> tokenizer;
+	};
+
+	struct TopLevelBlock
+	{
+		// Each block has its own arena so it can be dropped or kept on its own
+		ParseTree tree;
+		std::shared_ptr<Source> source;
+		// Offset just past the last token, a block owns the text from the end of
+		// the block before it up to here
+		size_t end;
+		// The tree's token offsets are behind by this much when edits before the
+		// block moved it, they are only caught up when the tree is used again
+		ptrdiff_t shift = 0;
+	};
+
+	Parser m_parser;
+	std::shared_ptr<Source> m_source;
+	// Every version still used by a block, each holds a whole copy of the text
+	std::vector<std::weak_ptr<Source>> m_versions;
+	std::vector<TopLevelBlock> m_blocks;
+	std::vector<std::unique_ptr<Statement>> m_statements;
+	// Index of the first block of each statement
+	std::vector<size_t> m_statementBlocks;
+	size_t m_reparsedBlocks = 0, m_recollapsedStatements = 0;
+
+	void parseAll();
+	std::vector<TopLevelBlock> parseBlocks(size_t first, size_t editEnd, ptrdiff_t delta, size_t& resume);
+	void collapse(size_t from, size_t to, ptrdiff_t blockShift, ptrdiff_t delta);
+	// Elif and else blocks collapse into the if statement before them
+	bool continuesStatement(size_t block) const;
+};
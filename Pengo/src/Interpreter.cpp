@@ -11,12 +11,13 @@ Interpreter::Interpreter(std::vector<std::unique_ptr<Statement>> statements)
 {
 	m_statements = std::move(statements);
 
-	m_globalEnvironment.m_functions[FUN_PRINT] = std::make_shared<Print>(Print());
-	m_globalEnvironment.m_functions[FUN_PRINTLN] = std::make_shared<PrintLn>(PrintLn());
-	m_globalEnvironment.m_functions[FUN_INPUT] = std::make_shared<Input>(Input());
-	m_globalEnvironment.m_functions[FUN_TOINT] = std::make_shared<ToInt>(ToInt());
-	m_globalEnvironment.m_functions[FUN_TOFLOAT] = std::make_shared<ToFloat>(ToFloat());
-	m_globalEnvironment.m_functions[FUN_RANDOM] = std::make_shared<Random>(Random());
+	SymbolTable& symbols = SymbolTable::global();
+	m_globalEnvironment.m_functions[symbols.intern(FUN_PRINT)] = std::make_shared<Print>(Print());
+	m_globalEnvironment.m_functions[symbols.intern(FUN_PRINTLN)] = std::make_shared<PrintLn>(PrintLn());
+	m_globalEnvironment.m_functions[symbols.intern(FUN_INPUT)] = std::make_shared<Input>(Input());
+	m_globalEnvironment.m_functions[symbols.intern(FUN_TOINT)] = std::make_shared<ToInt>(ToInt());
+	m_globalEnvironment.m_functions[symbols.intern(FUN_TOFLOAT)] = std::make_shared<ToFloat>(ToFloat());
+	m_globalEnvironment.m_functions[symbols.intern(FUN_RANDOM)] = std::make_shared<Random>(Random());
 
 	m_random.seed(time(NULL));
 	m_globalEnvironment.type = EnvironmentType::Global;
@@ -29,7 +30,12 @@ Interpreter::~Interpreter()
 
 void Interpreter::interpret()
 {
-	for (const std::unique_ptr<Statement>& statement : m_statements)
+	interpret(m_statements);
+}
+
+void Interpreter::interpret(const std::vector<std::unique_ptr<Statement>>& statements)
+{
+	for (const std::unique_ptr<Statement>& statement : statements)
 		statement->accept(*this);
 }
 
@@ -55,14 +61,14 @@ void Interpreter::visitReturn(ReturnStatement* statement)
 
 void Interpreter::visitFuncDeclare(FuncDeclareStatement* statement)
 {
-	std::vector<std::string> params;
+	std::vector<Atom> params;
 	for (Token& token : statement->params)
-		params.push_back(token.token);
+		params.push_back(token.atom);
 	std::shared_ptr<UserFunction> func = std::make_shared<UserFunction>(UserFunction(statement->params.size(), params, statement->body));
 	if (m_envStack.size() == 0)
-		m_globalEnvironment.m_functions[statement->name.token] = func;
+		m_globalEnvironment.m_functions[statement->name.atom] = func;
 	else
-		m_envStack.top().m_functions[statement->name.token] = func;
+		m_envStack.top().m_functions[statement->name.atom] = func;
 }
 
 void Interpreter::visitWhile(WhileStatement* statement)
@@ -117,21 +123,25 @@ void Interpreter::visitVarDeclare(VarDeclareStatement* statement)
 {
 	Token& name = statement->name;
 	for (int i = m_envStack.size() - 1; i >= 0; i--)
-		if (m_envStack.begin()[i].hasVariable(name.token))
+	{
+		auto it = m_envStack.begin()[i].m_variables.find(name.atom);
+		if (it != m_envStack.begin()[i].m_variables.end())
 		{
-			m_envStack.begin()[i].m_variables[name.token] = evaluate(statement->exp);
+			it->second = evaluate(statement->exp);
 			return;
 		}
-	if (m_globalEnvironment.hasVariable(name.token))
+	}
+	auto it = m_globalEnvironment.m_variables.find(name.atom);
+	if (it != m_globalEnvironment.m_variables.end())
 	{
-		m_globalEnvironment.m_variables[name.token] = evaluate(statement->exp);
+		it->second = evaluate(statement->exp);
 		return;
 	}
 
 	if (m_envStack.empty())
-		m_globalEnvironment.m_variables[statement->name.token] = evaluate(statement->exp);
+		m_globalEnvironment.m_variables[name.atom] = evaluate(statement->exp);
 	else
-		m_envStack.top().m_variables[statement->name.token] = evaluate(statement->exp);
+		m_envStack.top().m_variables[name.atom] = evaluate(statement->exp);
 }
 
 Value Interpreter::visitLogical(LogicalExpression* expression)
@@ -142,7 +152,8 @@ Value Interpreter::visitLogical(LogicalExpression* expression)
 
 	if (left.type != ValueType::Bool || right.type != ValueType::Bool)
 	{
-		std::cout << "Error at (" << op.line << ":" << op.pos << "):" << std::endl;
+		LineIndex::Location at = LineIndex::script().locate(op.offset);
+		std::cout << "Error at (" << at.line << ":" << at.pos << "):" << std::endl;
 		std::cout << "Left and right hand side types must be booleans" << std::endl;
 		exit(-2);
 	}
@@ -161,7 +172,8 @@ Value Interpreter::visitConditional(ConditionalExpression* expression)
 
 	if (left.type != right.type)
 	{
-		std::cout << "Error at (" << op.line << ":" << op.pos << "):" << std::endl;
+		LineIndex::Location at = LineIndex::script().locate(op.offset);
+		std::cout << "Error at (" << at.line << ":" << at.pos << "):" << std::endl;
 		std::cout << "Left and right hand side types do not match" << std::endl;
 		exit(-2);
 	}
@@ -195,7 +207,8 @@ Value Interpreter::visitConditional(ConditionalExpression* expression)
 	{
 		if (left.type != ValueType::Integer)
 		{
-			std::cout << "Error at (" << op.line << ":" << op.pos << "):" << std::endl;
+			LineIndex::Location at = LineIndex::script().locate(op.offset);
+			std::cout << "Error at (" << at.line << ":" << at.pos << "):" << std::endl;
 			std::cout << "Left and right hand side types must be integers" << std::endl;
 			exit(-2);
 		}
@@ -333,7 +346,8 @@ Value Interpreter::visitBinary(BinaryExpression* expression)
 		}
 		else
 		{
-			std::cout << "Error at (" << op.line << ":" << op.pos << "):" << std::endl;
+			LineIndex::Location at = LineIndex::script().locate(op.offset);
+			std::cout << "Error at (" << at.line << ":" << at.pos << "):" << std::endl;
 			std::cout << "Cannot use operator " << op.token << " here" << std::endl;
 			std::cin.get();
 		}
@@ -342,15 +356,7 @@ Value Interpreter::visitBinary(BinaryExpression* expression)
 
 Value Interpreter::visitLiteral(LiteralExpression* expression)
 {
-	Token& val = expression->value;
-	switch (val.type)
-	{
-	case TokenType::Integer: return { ValueType::Integer, std::stoi(val.token) };
-	case TokenType::Float: return { ValueType::Float, std::stof(val.token) };
-	case TokenType::String: return { ValueType::String, val.token };
-	case TokenType::Bool: return { ValueType::Bool, val.token == "true" ? true : false };
-	}
-	return {ValueType::Null };
+	return expression->value;
 }
 
 Value Interpreter::visitVar(VarExpression* expression)
@@ -378,14 +384,16 @@ Value Interpreter::findVariable(const Token& name)
 	for (int i = m_envStack.size() - 1; i >= 0; i--)
 	{
 		auto& env = m_envStack.begin()[i];
-		if (env.hasVariable(name.token))
+		if (env.hasVariable(name.atom))
 			return env.getVariable(name);
-		else if (env.m_functions.find(name.token) != env.m_functions.end())
-			return { ValueType::Function, env.m_functions[name.token] };
+		auto func = env.m_functions.find(name.atom);
+		if (func != env.m_functions.end())
+			return { ValueType::Function, func->second };
 	}
-	if(m_globalEnvironment.hasVariable(name.token))
+	if(m_globalEnvironment.hasVariable(name.atom))
 		return m_globalEnvironment.getVariable(name);
-	else if (m_globalEnvironment.m_functions.find(name.token) != m_globalEnvironment.m_functions.end())
-		return { ValueType::Function, m_globalEnvironment.m_functions[name.token] };
+	auto func = m_globalEnvironment.m_functions.find(name.atom);
+	if (func != m_globalEnvironment.m_functions.end())
+		return { ValueType::Function, func->second };
 	return m_globalEnvironment.getVariable(name);
 }
\ No newline at end of file
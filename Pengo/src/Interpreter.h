@@ -16,10 +16,12 @@
 class Interpreter : private Expression::Visitor, private Statement::Visitor
 {
 public:
-	Interpreter(std::vector<std::unique_ptr<Statement>> statements);
+	Interpreter(std::vector<std::unique_ptr<Statement>> statements = {});
 	~Interpreter();
 
 	void interpret();
+	// Runs statements owned by someone else, e.g. the IncrementalParser
+	void interpret(const std::vector<std::unique_ptr<Statement>>& statements);
 
 	Value toString(const Value& value);
 
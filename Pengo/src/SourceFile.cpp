@@ -0,0 +1,150 @@
+#include "SourceFile.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SourceFile::~SourceFile()
+{
+	close();
+}
+
+#ifdef _WIN32
+
+bool SourceFile::open(const char* path)
+{
+	close();
+	bool isStdin = std::strcmp(path, "-") == 0;
+	HANDLE file = isStdin ? GetStdHandle(STD_INPUT_HANDLE) :
+		CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE || file == nullptr)
+		return false;
+
+	bool success;
+	LARGE_INTEGER size;
+	if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size))
+		success = map((intptr_t)file, (size_t)size.QuadPart) || readAll((intptr_t)file);
+	else
+		success = readAll((intptr_t)file);
+
+	if (!isStdin)
+		CloseHandle(file);
+	return success;
+}
+
+void SourceFile::close()
+{
+	if (m_mapped)
+	{
+		UnmapViewOfFile(m_data);
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+	}
+	m_data = nullptr;
+	m_size = 0;
+	m_mapped = false;
+	m_buffer.clear();
+}
+
+bool SourceFile::map(intptr_t handle, size_t size)
+{
+	// Zero length files cannot be mapped, they are just an empty view
+	if (size == 0)
+		return true;
+	m_mapping = CreateFileMappingA((HANDLE)handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_mapping == nullptr)
+		return false;
+	const void* data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+	if (data == nullptr)
+	{
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+		return false;
+	}
+	m_data = (const char*)data;
+	m_size = size;
+	m_mapped = true;
+	return true;
+}
+
+bool SourceFile::readAll(intptr_t handle)
+{
+	char chunk[64 * 1024];
+	DWORD read;
+	while (ReadFile((HANDLE)handle, chunk, sizeof(chunk), &read, nullptr) && read > 0)
+		m_buffer.append(chunk, read);
+	m_data = m_buffer.data();
+	m_size = m_buffer.size();
+	return true;
+}
+
+#else
+
+bool SourceFile::open(const char* path)
+{
+	close();
+	bool isStdin = std::strcmp(path, "-") == 0;
+	int fd = isStdin ? STDIN_FILENO : ::open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	bool success;
+	struct stat info;
+	if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+		success = map(fd, (size_t)info.st_size) || readAll(fd);
+	else
+		success = readAll(fd);
+
+	if (!isStdin)
+		::close(fd);
+	return success;
+}
+
+void SourceFile::close()
+{
+	if (m_mapped)
+		munmap((void*)m_data, m_size);
+	m_data = nullptr;
+	m_size = 0;
+	m_mapped = false;
+	m_buffer.clear();
+}
+
+bool SourceFile::map(intptr_t handle, size_t size)
+{
+	// Zero length files cannot be mapped, they are just an empty view
+	if (size == 0)
+		return true;
+	void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, (int)handle, 0);
+	if (data == MAP_FAILED)
+		return false;
+	madvise(data, size, MADV_SEQUENTIAL);
+	m_data = (const char*)data;
+	m_size = size;
+	m_mapped = true;
+	return true;
+}
+
+bool SourceFile::readAll(intptr_t handle)
+{
+	char chunk[64 * 1024];
+	ssize_t bytes;
+	while ((bytes = ::read((int)handle, chunk, sizeof(chunk))) > 0)
+		m_buffer.append(chunk, (size_t)bytes);
+	if (bytes < 0)
+		return false;
+	m_data = m_buffer.data();
+	m_size = m_buffer.size();
+	return true;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Read-only view of a script. Regular files are memory mapped so the tokenizer
+// can work straight out of the page cache, anything that cannot be mapped
+// (pipes, terminals, "-" for stdin) is read into an owned buffer instead.
+class SourceFile
+{
+public:
+	SourceFile() = default;
+	~SourceFile();
+
+	SourceFile(const SourceFile&) = delete;
+	SourceFile& operator=(const SourceFile&) = delete;
+
+	bool open(const char* path);
+	void close();
+
+	inline std::string_view view() const { return { m_data, m_size }; }
+	inline bool isMapped() const { return m_mapped; }
+private:
+	const char* m_data = nullptr;
+	size_t m_size = 0;
+	bool m_mapped = false;
+	std::string m_buffer;
+
+#ifdef _WIN32
+	void* m_mapping = nullptr;
+#endif
+
+	bool map(intptr_t handle, size_t size);
+	bool readAll(intptr_t handle);
+};
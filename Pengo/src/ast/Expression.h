@@ -79,7 +79,8 @@ struct BinaryExpression : public Expression
 
 struct LiteralExpression : public Expression
 {
-	Token value;
+	// Built from the decoded token, evaluating is just a copy
+	Value value;
 
 	inline Value accept(Expression::Visitor& visitor) { return visitor.visitLiteral(this); }
 };
@@ -1,9 +1,13 @@
 #include <string>
 #include "tokenizer\Token.h"
 #include "tokenizer\Tokenizer.h"
+#include "tokenizer\ParallelTokenizer.h"
 #include <iostream>
-#include <sstream>
-#include <fstream>
+#include <thread>
+#include <chrono>
+#include <filesystem>
+#include <algorithm>
+#include <charconv>
 
 #include <queue>
 
@@ -11,6 +15,11 @@
 
 #include "Interpreter.h"
 #include "Collapse.h"
+#include "SourceFile.h"
+#include "IncrementalParser.h"
+
+// How often -w checks the file for changes, in milliseconds
+#define WATCH_INTERVAL 200
 
 std::string getType(NodeType type)
 {
@@ -53,7 +62,7 @@ std::string getType(NodeType type)
 }
 
 #define INC 3
-void print(Node& node, int &inc)
+void print(const ParseTree& tree, const Node& node, int &inc)
 {
 	for (int i = 0; i < inc; i++)
 		std::cout << " ";
@@ -62,14 +71,97 @@ void print(Node& node, int &inc)
 	{
 		for (int i = 0; i < inc + INC; i++)
 			std::cout << " ";
-		std::cout << node.token.token << std::endl;
+		std::cout << tree.token(node).token << std::endl;
 	}
 	inc += INC;
-	for (Node& child : node.children)
-		print(child, inc);
+	for (const Node& child : tree.children(node))
+		print(tree, child, inc);
 	inc -= INC;
 }
 
+// The tokens have to outlive the interpreter, string literals point into them
+template<typename TokenStream>
+void run(TokenStream& tokens, bool debug, const char* tables)
+{
+	Parser parser;
+	if (tables != nullptr && !parser.loadTables(tables))
+		exit(-1);
+
+	// Print the parse tree, without -d the AST is built straight from the reductions.
+	// Loaded tables have no actions so they always go through the tree
+	if (debug || parser.hasLoadedTables())
+	{
+		ParseTree base = parser.parse(tokens);
+		int inc = 0;
+		if (debug)
+		{
+			print(base, base.root(), inc);
+			std::cout << std::endl;
+		}
+
+		Interpreter interpreter(collapseParseTree(base));
+		interpreter.interpret();
+		return;
+	}
+
+	SemanticValue file = parser.build(tokens);
+	Interpreter interpreter(takeStatements(file));
+	interpreter.interpret();
+}
+
+static std::string readSource(const char* path)
+{
+	SourceFile source;
+	if (!source.open(path))
+	{
+		std::cout << path << " does not exist!" << std::endl;
+		exit(-1);
+	}
+	return std::string(source.view());
+}
+
+// Runs the script again every time the file is saved, only re-parsing around the change
+void watch(const char* path, bool debug)
+{
+	IncrementalParser parser(readSource(path));
+	LineIndex::script().reset(parser.source());
+	std::error_code error;
+	std::filesystem::file_time_type modified = std::filesystem::last_write_time(path, error);
+	while (true)
+	{
+		if (debug)
+		{
+			ParseTree tree = parser.tree();
+			int inc = 0;
+			print(tree, tree.root(), inc);
+			std::cout << std::endl;
+		}
+		Interpreter interpreter;
+		interpreter.interpret(parser.statements());
+
+		// Editors can replace the file when saving, so a missing file is waited out too
+		std::filesystem::file_time_type next = modified;
+		while (next == modified || error)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_INTERVAL));
+			next = std::filesystem::last_write_time(path, error);
+		}
+		modified = next;
+
+		// The edit is whatever is left between the common prefix and suffix
+		std::string source = readSource(path);
+		const std::string& old = parser.source();
+		size_t prefix = std::mismatch(old.begin(), old.end(), source.begin(), source.end()).first - old.begin();
+		size_t suffix = 0;
+		while (suffix < std::min(old.size(), source.size()) - prefix && old[old.size() - 1 - suffix] == source[source.size() - 1 - suffix])
+			suffix++;
+		parser.edit(prefix, old.size() - prefix - suffix, std::string_view(source).substr(prefix, source.size() - prefix - suffix));
+		LineIndex::script().reset(parser.source());
+		if (debug)
+			std::cout << "Reparsed " << parser.reparsedBlocks() << " of " << parser.blockCount() << " blocks" << std::endl;
+	}
+}
+
 int main(int argc, char* args[])
 {
 	if (argc == 1)
@@ -79,38 +171,78 @@ int main(int argc, char* args[])
 	else
 	{
 		bool debug = false;
-		if (argc == 3)
-			if (std::string(args[2]) == std::string("-d"))
+		bool watching = false;
+		int threads = 1;
+		const char* tables = nullptr;
+		for (int i = 2; i < argc; i++)
+		{
+			std::string arg = args[i];
+			if (arg == "-d")
 				debug = true;
+			else if (arg == "-w")
+				watching = true;
+			// -g loads the parse tables Peg wrote with -tables instead of the built in ones
+			else if (arg == "-g")
+			{
+				if (i + 1 == argc)
+				{
+					std::cout << "Expected a table file after -g!" << std::endl;
+					exit(-1);
+				}
+				tables = args[++i];
+			}
+			// -j uses every core, -jN uses N threads to tokenize
+			else if (arg.rfind("-j", 0) == 0)
+			{
+				if (arg.size() == 2)
+					threads = (int)std::thread::hardware_concurrency();
+				else
+				{
+					auto [end, error] = std::from_chars(arg.data() + 2, arg.data() + arg.size(), threads);
+					if (error != std::errc() || end != arg.data() + arg.size() || threads < 1)
+					{
+						std::cout << "Expected a positive thread count after -j, got " << arg << "!" << std::endl;
+						exit(-1);
+					}
+				}
+			}
+		}
 		const char* path = args[1];
-		std::ifstream file(path);
+		if (watching)
+		{
+			if (std::string(path) == "-")
+			{
+				std::cout << "Cannot watch standard input!" << std::endl;
+				exit(-1);
+			}
+			if (tables != nullptr)
+			{
+				std::cout << "Cannot watch with loaded tables!" << std::endl;
+				exit(-1);
+			}
+			watch(path, debug);
+			return 0;
+		}
+		SourceFile source;
 
-		if (!file.is_open())
+		if (!source.open(path))
 		{
 			std::cout << path << " does not exist!" << std::endl;
 			exit(-1);
 		}
-		std::stringstream stream;
-		stream << file.rdbuf();
-
-		std::string source = stream.str();
-
-		Tokenizer t(source);
-		std::vector<Token> tokens = t.tokenize();
+		LineIndex::script().reset(source.view());
 
-		Parser parser;
-
-		Node base = parser.parse(tokens);
-
-		// Print the parse tree
-		if (debug)
+		// Only -j buffers the whole file, one thread pulls the tokens as it parses
+		if (threads > 1)
 		{
-			int inc = 0;
-			print(base, inc);
-			std::cout << std::endl;
+			ParallelTokenizer t(source.view(), threads);
+			TokenBuffer::Cursor tokens = t.tokens().cursor();
+			run(tokens, debug, tables);
+		}
+		else
+		{
+			Tokenizer t(source.view());
+			run(t, debug, tables);
 		}
-
-		Interpreter interpreter(collapseParseTree(&base));
-		interpreter.interpret();
 	}
 }
\ No newline at end of file
@@ -1,53 +1,65 @@
 #pragma once
 #include "../tokenizer/Token.h"
+#include "../tokenizer/LineIndex.h"
+#include <array>
+#include <cstdint>
+#include <span>
 #include <vector>
 #include <stack>
 #include <queue>
-#include <unordered_map>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include "../SourceFile.h"
+#include "../AstBuilder.h"
 #define SET_NUM 101
 #define GRAMMAR_NUM 65
+#define NODE_NUM 31
+// _EOF is the last token type
+#define TOKEN_NUM ((int)TokenType::_EOF + 1)
+#define TABLES_VERSION 1
 enum class NodeType
 {
-	File,
-	Arguments,
-	Statements,
-	ParamRecurse,
-	FunctionDeclareStatement,
-	Block,
-	Statement,
-	Parameters,
-	ReturnStatement,
-	VarDeclareStatement,
-	Term,
-	WhileStatement,
-	IfStatement,
-	ElseIfStatement,
 	ElseStatement,
 	Expression,
+	ElseIfStatement,
 	Logical,
-	LogicalOp,
+	VarDeclareStatement,
 	Conditional,
-	Grouping,
-	ConditionalOp,
-	TermOp,
-	Factor,
+	ParamRecurse,
+	ReturnStatement,
 	FactorOp,
+	Statement,
+	Block,
+	FunctionDeclareStatement,
+	LogicalOp,
+	Statements,
+	File,
+	ConditionalOp,
 	Unary,
+	Parameters,
+	Primary,
+	Term,
+	IfStatement,
+	Factor,
+	WhileStatement,
+	TermOp,
 	UnaryOp,
+	Identifier,
 	Call,
-	ArgRecurse,
-	Primary,
+	Arguments,
+	Grouping,
 	Literal,
-	Identifier,
+	ArgRecurse,
 };
 struct Node
 {
 	NodeType type;
 	bool terminal = false;
-	Token token;
-	std::vector<Node> children;
+	// Terminals index the tree's tokens, the rest their first child in its nodes
+	uint32_t index = 0;
+	uint32_t count = 0;
 };
 enum class ActionType
 {
@@ -67,1434 +79,2728 @@ struct Production
 	int rhs = 0;
 	int rhsNodes = 0;
 	bool terminates = false;
+	// A unit rule without an action, its node or value is just its child's
+	bool passThrough = false;
+};
+// Start of a table file Peg writes with -tables. The token and node names follow,
+// NUL terminated and padded to 4 bytes, then the rules as { lhs, rhs, rhsNodes,
+// flags } and the dense layout's default actions, reduce only flags (padded),
+// action table and goto table. Columns are in the order of the names.
+struct TablesHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t states, tokens, nodes, rules;
+	uint32_t namesSize;
+};
+// Nodes are bump allocated as the rules are reduced, each reduction appends its
+// children in order so they sit next to each other. The root is always last.
+struct ParseTree
+{
+	std::vector<Node> nodes;
+	std::vector<Token> tokens;
+
+	inline const Node& root() const { return nodes.back(); }
+	inline std::span<const Node> children(const Node& node) const { return { nodes.data() + node.index, node.count }; }
+	inline const Token& token(const Node& node) const { return tokens[node.index]; }
+
+	// Turns the top of the output stack into the node a rule reduces to
+	inline void reduce(std::vector<Node>& output, const Production& production, const Token& lastToken)
+	{
+		if (production.passThrough)
+			return;
+		Node node;
+		node.type = production.lhs;
+		node.terminal = production.terminates;
+		if (production.terminates)
+		{
+			node.index = (uint32_t)tokens.size();
+			tokens.push_back(lastToken);
+		}
+		else
+		{
+			node.index = (uint32_t)nodes.size();
+			node.count = production.rhsNodes;
+			nodes.insert(nodes.end(), output.end() - production.rhsNodes, output.end());
+			output.resize(output.size() - production.rhsNodes);
+		}
+		output.push_back(node);
+	}
+};
+// The parser reads the current token's type and only builds the Token when it
+// shifts one. A TokenBuffer::Cursor reads its type array like that, streams
+// with a Token next() such as the Tokenizer are pulled through this instead
+template<typename TokenStream>
+class PulledTokens
+{
+public:
+	PulledTokens(TokenStream& stream) : m_stream(stream), m_current(stream.next()) { }
+
+	inline TokenType type() const { return m_current.type; }
+	inline const Token& token() const { return m_current; }
+	inline void advance() { m_current = m_stream.next(); }
+private:
+	TokenStream& m_stream;
+	Token m_current;
 };
 class Parser
 {
 public:
-	Parser()
+	// Takes a TokenBuffer::Cursor or anything with a Token next(), e.g. the Tokenizer
+	template<typename TokenStream>
+	ParseTree parse(TokenStream& tokens)
 	{
-		m_actionTable[8][TokenType::OrOr] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::AndAnd] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::Asterisk] = { ActionType::Shift, 46 };
-		m_actionTable[8][TokenType::Slash] = { ActionType::Shift, 47 };
-		m_actionTable[8][TokenType::Semicolon] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::LessThanEqual] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::LessThan] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::NotEqual] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::GreaterThanEqual] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::GreaterThan] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::EqualEqual] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::RightParen] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::Minus] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::Plus] = { ActionType::Reduce, 40 };
-		m_actionTable[8][TokenType::Comma] = { ActionType::Reduce, 40 };
-		m_actionTable[64][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[64][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[64][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[64][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[64][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[64][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[64][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[64][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[0][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[0][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[0][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[0][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[0][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[0][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[0][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[0][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[0][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[0][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[0][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[0][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[0][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[0][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[0][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[2][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[2][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[2][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[2][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[2][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[2][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[2][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[2][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[2][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[2][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[2][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[2][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[2][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[2][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[2][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[2][TokenType::_EOF] = { ActionType::Reduce, 1 };
-		m_actionTable[67][TokenType::RightCurly] = { ActionType::Shift, 81 };
-		m_actionTable[67][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[67][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[67][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[67][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[67][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[67][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[67][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[67][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[67][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[67][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[67][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[67][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[67][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[67][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[67][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[3][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[3][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[3][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[3][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[3][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[3][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[3][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[3][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[3][TokenType::Semicolon] = { ActionType::Reduce, 19 };
-		m_actionTable[4][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[69][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[69][TokenType::RightParen] = { ActionType::Reduce, 15 };
-		m_actionTable[5][TokenType::LeftParen] = { ActionType::Shift, 43 };
-		m_actionTable[7][TokenType::Equal] = { ActionType::Shift, 44 };
-		m_actionTable[7][TokenType::Semicolon] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::LessThanEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::OrOr] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::AndAnd] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::LessThan] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::NotEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::GreaterThanEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::GreaterThan] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::EqualEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::Minus] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::Plus] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::Slash] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::Asterisk] = { ActionType::Reduce, 57 };
-		m_actionTable[7][TokenType::LeftParen] = { ActionType::Reduce, 57 };
-		m_actionTable[73][TokenType::RightParen] = { ActionType::Shift, 85 };
-		m_actionTable[9][TokenType::LeftParen] = { ActionType::Shift, 48 };
-		m_actionTable[74][TokenType::RightParen] = { ActionType::Shift, 86 };
-		m_actionTable[10][TokenType::LeftParen] = { ActionType::Shift, 49 };
-		m_actionTable[75][TokenType::OrOr] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::AndAnd] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::Asterisk] = { ActionType::Shift, 46 };
-		m_actionTable[75][TokenType::Slash] = { ActionType::Shift, 47 };
-		m_actionTable[75][TokenType::Semicolon] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::LessThanEqual] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::RightParen] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::GreaterThanEqual] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::LessThan] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::GreaterThan] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::NotEqual] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::EqualEqual] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::Minus] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::Plus] = { ActionType::Reduce, 39 };
-		m_actionTable[75][TokenType::Comma] = { ActionType::Reduce, 39 };
-		m_actionTable[11][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[11][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[11][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[11][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[11][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[11][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[11][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[11][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[11][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[11][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[11][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[11][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[11][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[11][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[11][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[17][TokenType::Minus] = { ActionType::Shift, 51 };
-		m_actionTable[17][TokenType::GreaterThanEqual] = { ActionType::Shift, 53 };
-		m_actionTable[17][TokenType::LessThanEqual] = { ActionType::Shift, 60 };
-		m_actionTable[17][TokenType::Plus] = { ActionType::Shift, 55 };
-		m_actionTable[17][TokenType::EqualEqual] = { ActionType::Shift, 56 };
-		m_actionTable[17][TokenType::LessThan] = { ActionType::Shift, 59 };
-		m_actionTable[17][TokenType::NotEqual] = { ActionType::Shift, 57 };
-		m_actionTable[17][TokenType::GreaterThan] = { ActionType::Shift, 58 };
-		m_actionTable[17][TokenType::Comma] = { ActionType::Reduce, 32 };
-		m_actionTable[17][TokenType::RightParen] = { ActionType::Reduce, 32 };
-		m_actionTable[17][TokenType::Semicolon] = { ActionType::Reduce, 32 };
-		m_actionTable[17][TokenType::OrOr] = { ActionType::Reduce, 32 };
-		m_actionTable[17][TokenType::AndAnd] = { ActionType::Reduce, 32 };
-		m_actionTable[82][TokenType::RightParen] = { ActionType::Shift, 90 };
-		m_actionTable[18][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[18][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[18][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[18][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[18][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[18][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[18][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[18][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[23][TokenType::LeftParen] = { ActionType::Shift, 62 };
-		m_actionTable[23][TokenType::Semicolon] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::LessThanEqual] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::OrOr] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::AndAnd] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::LessThan] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::NotEqual] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::GreaterThanEqual] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::GreaterThan] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::EqualEqual] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::RightParen] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::Minus] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::Plus] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::Comma] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::Slash] = { ActionType::Reduce, 48 };
-		m_actionTable[23][TokenType::Asterisk] = { ActionType::Reduce, 48 };
-		m_actionTable[89][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[89][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[89][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[89][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[89][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[89][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[89][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[89][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[25][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[25][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[25][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[25][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[25][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[25][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[25][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[25][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[92][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[28][TokenType::AndAnd] = { ActionType::Shift, 66 };
-		m_actionTable[28][TokenType::OrOr] = { ActionType::Shift, 65 };
-		m_actionTable[28][TokenType::Comma] = { ActionType::Reduce, 26 };
-		m_actionTable[28][TokenType::RightParen] = { ActionType::Reduce, 26 };
-		m_actionTable[28][TokenType::Semicolon] = { ActionType::Reduce, 26 };
-		m_actionTable[96][TokenType::Comma] = { ActionType::Shift, 89 };
-		m_actionTable[96][TokenType::RightParen] = { ActionType::Reduce, 55 };
-		m_actionTable[32][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[32][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[32][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[32][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[32][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[32][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[32][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[32][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[32][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[32][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[32][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[32][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[32][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[32][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[32][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[33][TokenType::Semicolon] = { ActionType::Shift, 68 };
-		m_actionTable[42][TokenType::LeftParen] = { ActionType::Shift, 69 };
-		m_actionTable[43][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[43][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[43][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[43][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[43][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[43][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[43][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[43][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[44][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[44][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[44][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[44][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[44][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[44][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[44][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[44][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[45][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[45][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[45][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[45][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[45][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[45][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[45][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[45][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[48][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[48][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[48][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[48][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[48][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[48][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[48][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[48][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[49][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[49][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[49][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[49][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[49][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[49][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[49][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[49][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[52][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[52][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[52][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[52][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[52][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[52][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[52][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[52][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[54][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[54][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[54][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[54][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[54][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[54][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[54][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[54][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[61][TokenType::RightParen] = { ActionType::Shift, 77 };
-		m_actionTable[62][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[62][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[62][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[62][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[62][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[62][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[62][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[62][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[62][TokenType::RightParen] = { ActionType::Reduce, 53 };
-		m_actionTable[6][TokenType::Comma] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::LessThan] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Semicolon] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::LessThanEqual] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::OrOr] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::AndAnd] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::GreaterThanEqual] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::GreaterThan] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::NotEqual] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::EqualEqual] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::RightParen] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Slash] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Asterisk] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::LeftParen] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Minus] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Plus] = { ActionType::Reduce, 64 };
-		m_actionTable[6][TokenType::Equal] = { ActionType::Reduce, 64 };
-		m_actionTable[70][TokenType::RightParen] = { ActionType::Shift, 84 };
-		m_actionTable[12][TokenType::Semicolon] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::LessThanEqual] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::OrOr] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::AndAnd] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::LessThan] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::NotEqual] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::GreaterThanEqual] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::GreaterThan] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::EqualEqual] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::RightParen] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::Minus] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::Plus] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::Comma] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::Slash] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::Asterisk] = { ActionType::Reduce, 61 };
-		m_actionTable[12][TokenType::LeftParen] = { ActionType::Reduce, 61 };
-		m_actionTable[76][TokenType::Minus] = { ActionType::Shift, 51 };
-		m_actionTable[76][TokenType::Semicolon] = { ActionType::Reduce, 31 };
-		m_actionTable[76][TokenType::Plus] = { ActionType::Shift, 55 };
-		m_actionTable[76][TokenType::Comma] = { ActionType::Reduce, 31 };
-		m_actionTable[76][TokenType::RightParen] = { ActionType::Reduce, 31 };
-		m_actionTable[76][TokenType::AndAnd] = { ActionType::Reduce, 31 };
-		m_actionTable[76][TokenType::OrOr] = { ActionType::Reduce, 31 };
-		m_actionTable[14][TokenType::Semicolon] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::LessThanEqual] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::OrOr] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::AndAnd] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::LessThan] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::NotEqual] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::GreaterThanEqual] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::GreaterThan] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::EqualEqual] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::RightParen] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::Minus] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::Plus] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::Comma] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::Slash] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::Asterisk] = { ActionType::Reduce, 63 };
-		m_actionTable[14][TokenType::LeftParen] = { ActionType::Reduce, 63 };
-		m_actionTable[78][TokenType::RightParen] = { ActionType::Shift, 87 };
-		m_actionTable[15][TokenType::Semicolon] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::LessThanEqual] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::OrOr] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::AndAnd] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::LessThan] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::NotEqual] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::GreaterThanEqual] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::GreaterThan] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::EqualEqual] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::RightParen] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::Minus] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::Plus] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::Comma] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::Slash] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::Asterisk] = { ActionType::Reduce, 65 };
-		m_actionTable[15][TokenType::LeftParen] = { ActionType::Reduce, 65 };
-		m_actionTable[79][TokenType::Comma] = { ActionType::Shift, 89 };
-		m_actionTable[79][TokenType::RightParen] = { ActionType::Reduce, 55 };
-		m_actionTable[19][TokenType::Integer] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::Float] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::Bool] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::Minus] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::String] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::LeftParen] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::Identifier] = { ActionType::Reduce, 50 };
-		m_actionTable[19][TokenType::Bang] = { ActionType::Reduce, 50 };
-		m_actionTable[83][TokenType::Comma] = { ActionType::Shift, 92 };
-		m_actionTable[83][TokenType::RightParen] = { ActionType::Reduce, 17 };
-		m_actionTable[20][TokenType::Semicolon] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::LessThanEqual] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::OrOr] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::AndAnd] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::LessThan] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::NotEqual] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::GreaterThanEqual] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::GreaterThan] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::EqualEqual] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::RightParen] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::Minus] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::Plus] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::Comma] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::Slash] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::Asterisk] = { ActionType::Reduce, 58 };
-		m_actionTable[20][TokenType::LeftParen] = { ActionType::Reduce, 58 };
-		m_actionTable[84][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[84][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[84][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[84][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[84][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[84][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[84][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[84][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[84][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[84][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[84][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[84][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[84][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[84][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[84][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[21][TokenType::Semicolon] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::LessThanEqual] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::OrOr] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::AndAnd] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::LessThan] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::NotEqual] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::GreaterThanEqual] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::GreaterThan] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::EqualEqual] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::RightParen] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::Minus] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::Plus] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::Comma] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::Slash] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::Asterisk] = { ActionType::Reduce, 59 };
-		m_actionTable[21][TokenType::LeftParen] = { ActionType::Reduce, 59 };
-		m_actionTable[85][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[85][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[85][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[85][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[85][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[85][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[85][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[85][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[85][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[85][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[85][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[85][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[85][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[85][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[85][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[22][TokenType::Semicolon] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::LessThanEqual] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::OrOr] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::AndAnd] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::LessThan] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::NotEqual] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::GreaterThanEqual] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::GreaterThan] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::EqualEqual] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::RightParen] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::Minus] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::Plus] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::Comma] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::Slash] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::Asterisk] = { ActionType::Reduce, 52 };
-		m_actionTable[22][TokenType::LeftParen] = { ActionType::Reduce, 52 };
-		m_actionTable[86][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[86][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[86][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[86][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[86][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[86][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[86][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[86][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[86][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[86][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[86][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[86][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[86][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[86][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[86][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[26][TokenType::Semicolon] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::LessThanEqual] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::OrOr] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::AndAnd] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::LessThan] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::NotEqual] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::GreaterThanEqual] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::GreaterThan] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::EqualEqual] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::RightParen] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::Minus] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::Plus] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::Comma] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::Slash] = { ActionType::Reduce, 44 };
-		m_actionTable[26][TokenType::Asterisk] = { ActionType::Reduce, 44 };
-		m_actionTable[90][TokenType::Func] = { ActionType::Shift, 4 };
-		m_actionTable[90][TokenType::ElseIf] = { ActionType::Shift, 5 };
-		m_actionTable[90][TokenType::Return] = { ActionType::Shift, 3 };
-		m_actionTable[90][TokenType::While] = { ActionType::Shift, 10 };
-		m_actionTable[90][TokenType::If] = { ActionType::Shift, 9 };
-		m_actionTable[90][TokenType::Identifier] = { ActionType::Shift, 6 };
-		m_actionTable[90][TokenType::Else] = { ActionType::Shift, 11 };
-		m_actionTable[90][TokenType::Integer] = { ActionType::Shift, 12 };
-		m_actionTable[90][TokenType::Float] = { ActionType::Shift, 13 };
-		m_actionTable[90][TokenType::String] = { ActionType::Shift, 14 };
-		m_actionTable[90][TokenType::Bool] = { ActionType::Shift, 15 };
-		m_actionTable[90][TokenType::LeftParen] = { ActionType::Shift, 18 };
-		m_actionTable[90][TokenType::Bang] = { ActionType::Shift, 19 };
-		m_actionTable[90][TokenType::Minus] = { ActionType::Shift, 24 };
-		m_actionTable[90][TokenType::LeftCurly] = { ActionType::Shift, 32 };
-		m_actionTable[98][TokenType::Comma] = { ActionType::Shift, 92 };
-		m_actionTable[98][TokenType::RightParen] = { ActionType::Reduce, 17 };
-		m_actionTable[1][TokenType::_EOF] = { ActionType::Accept }; ;
-		m_actionTable[13][TokenType::Semicolon] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::LessThanEqual] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::OrOr] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::AndAnd] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::LessThan] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::NotEqual] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::GreaterThanEqual] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::GreaterThan] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::EqualEqual] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::RightParen] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::Minus] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::Plus] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::Comma] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::Slash] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::Asterisk] = { ActionType::Reduce, 62 };
-		m_actionTable[13][TokenType::LeftParen] = { ActionType::Reduce, 62 };
-		m_actionTable[16][TokenType::RightCurly] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Else] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::_EOF] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::ElseIf] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Func] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Return] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::While] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::If] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Identifier] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Bool] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::String] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Float] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Integer] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::LeftParen] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Bang] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::Minus] = { ActionType::Reduce, 9 };
-		m_actionTable[16][TokenType::LeftCurly] = { ActionType::Reduce, 9 };
-		m_actionTable[24][TokenType::Integer] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::Float] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::Bool] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::Minus] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::String] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::LeftParen] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::Identifier] = { ActionType::Reduce, 49 };
-		m_actionTable[24][TokenType::Bang] = { ActionType::Reduce, 49 };
-		m_actionTable[27][TokenType::Comma] = { ActionType::Reduce, 28 };
-		m_actionTable[27][TokenType::RightParen] = { ActionType::Reduce, 28 };
-		m_actionTable[27][TokenType::Semicolon] = { ActionType::Reduce, 28 };
-		m_actionTable[27][TokenType::AndAnd] = { ActionType::Reduce, 28 };
-		m_actionTable[27][TokenType::OrOr] = { ActionType::Reduce, 28 };
-		m_actionTable[29][TokenType::Semicolon] = { ActionType::Reduce, 11 };
-		m_actionTable[30][TokenType::Semicolon] = { ActionType::Reduce, 12 };
-		m_actionTable[31][TokenType::Semicolon] = { ActionType::Reduce, 13 };
-		m_actionTable[34][TokenType::RightCurly] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Else] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::_EOF] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::ElseIf] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Func] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Return] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::While] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::If] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Identifier] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Bool] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::String] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Float] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Integer] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::LeftParen] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Bang] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::Minus] = { ActionType::Reduce, 6 };
-		m_actionTable[34][TokenType::LeftCurly] = { ActionType::Reduce, 6 };
-		m_actionTable[35][TokenType::RightCurly] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Else] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::_EOF] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::ElseIf] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Func] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Return] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::While] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::If] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Identifier] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Bool] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::String] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Float] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Integer] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::LeftParen] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Bang] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::Minus] = { ActionType::Reduce, 7 };
-		m_actionTable[35][TokenType::LeftCurly] = { ActionType::Reduce, 7 };
-		m_actionTable[36][TokenType::RightCurly] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Else] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::_EOF] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::ElseIf] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Func] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Return] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::While] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::If] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Identifier] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Bool] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::String] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Float] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Integer] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::LeftParen] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Bang] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::Minus] = { ActionType::Reduce, 8 };
-		m_actionTable[36][TokenType::LeftCurly] = { ActionType::Reduce, 8 };
-		m_actionTable[37][TokenType::RightCurly] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Else] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::_EOF] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::ElseIf] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Func] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Return] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::While] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::If] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Identifier] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Bool] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::String] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Float] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Integer] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::LeftParen] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Bang] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::Minus] = { ActionType::Reduce, 10 };
-		m_actionTable[37][TokenType::LeftCurly] = { ActionType::Reduce, 10 };
-		m_actionTable[38][TokenType::RightCurly] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Else] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::_EOF] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::ElseIf] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Func] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Return] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::While] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::If] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Identifier] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Bool] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::String] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Float] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Integer] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::LeftParen] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Bang] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::Minus] = { ActionType::Reduce, 3 };
-		m_actionTable[38][TokenType::LeftCurly] = { ActionType::Reduce, 3 };
-		m_actionTable[39][TokenType::RightCurly] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Else] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::_EOF] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::ElseIf] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Func] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Return] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::While] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::If] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Identifier] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Bool] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::String] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Float] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Integer] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::LeftParen] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Bang] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::Minus] = { ActionType::Reduce, 2 };
-		m_actionTable[39][TokenType::LeftCurly] = { ActionType::Reduce, 2 };
-		m_actionTable[40][TokenType::Semicolon] = { ActionType::Reduce, 20 };
-		m_actionTable[41][TokenType::Semicolon] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::LessThanEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::OrOr] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::AndAnd] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::LessThan] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::NotEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::GreaterThanEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::GreaterThan] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::EqualEqual] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::RightParen] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::Minus] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::Plus] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::Comma] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::Slash] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::Asterisk] = { ActionType::Reduce, 57 };
-		m_actionTable[41][TokenType::LeftParen] = { ActionType::Reduce, 57 };
-		m_actionTable[46][TokenType::Integer] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::Float] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::Bool] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::Minus] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::String] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::LeftParen] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::Identifier] = { ActionType::Reduce, 45 };
-		m_actionTable[46][TokenType::Bang] = { ActionType::Reduce, 45 };
-		m_actionTable[47][TokenType::Integer] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::Float] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::Bool] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::Minus] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::String] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::LeftParen] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::Identifier] = { ActionType::Reduce, 46 };
-		m_actionTable[47][TokenType::Bang] = { ActionType::Reduce, 46 };
-		m_actionTable[50][TokenType::RightCurly] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Else] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::_EOF] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::ElseIf] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Func] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Return] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::While] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::If] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Identifier] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Bool] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::String] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Float] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Integer] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::LeftParen] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Bang] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::Minus] = { ActionType::Reduce, 25 };
-		m_actionTable[50][TokenType::LeftCurly] = { ActionType::Reduce, 25 };
-		m_actionTable[51][TokenType::Integer] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::Float] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::Bool] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::Minus] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::String] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::LeftParen] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::Identifier] = { ActionType::Reduce, 42 };
-		m_actionTable[51][TokenType::Bang] = { ActionType::Reduce, 42 };
-		m_actionTable[53][TokenType::Integer] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::Float] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::Bool] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::Minus] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::String] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::LeftParen] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::Identifier] = { ActionType::Reduce, 36 };
-		m_actionTable[53][TokenType::Bang] = { ActionType::Reduce, 36 };
-		m_actionTable[55][TokenType::Integer] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::Float] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::Bool] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::Minus] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::String] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::LeftParen] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::Identifier] = { ActionType::Reduce, 41 };
-		m_actionTable[55][TokenType::Bang] = { ActionType::Reduce, 41 };
-		m_actionTable[56][TokenType::Integer] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::Float] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::Bool] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::Minus] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::String] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::LeftParen] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::Identifier] = { ActionType::Reduce, 33 };
-		m_actionTable[56][TokenType::Bang] = { ActionType::Reduce, 33 };
-		m_actionTable[57][TokenType::Integer] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::Float] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::Bool] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::Minus] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::String] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::LeftParen] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::Identifier] = { ActionType::Reduce, 34 };
-		m_actionTable[57][TokenType::Bang] = { ActionType::Reduce, 34 };
-		m_actionTable[58][TokenType::Integer] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::Float] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::Bool] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::Minus] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::String] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::LeftParen] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::Identifier] = { ActionType::Reduce, 35 };
-		m_actionTable[58][TokenType::Bang] = { ActionType::Reduce, 35 };
-		m_actionTable[59][TokenType::Integer] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::Float] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::Bool] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::Minus] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::String] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::LeftParen] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::Identifier] = { ActionType::Reduce, 37 };
-		m_actionTable[59][TokenType::Bang] = { ActionType::Reduce, 37 };
-		m_actionTable[60][TokenType::Integer] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::Float] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::Bool] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::Minus] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::String] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::LeftParen] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::Identifier] = { ActionType::Reduce, 38 };
-		m_actionTable[60][TokenType::Bang] = { ActionType::Reduce, 38 };
-		m_actionTable[63][TokenType::Semicolon] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::LessThanEqual] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::OrOr] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::AndAnd] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::RightParen] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::GreaterThanEqual] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::LessThan] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::GreaterThan] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::NotEqual] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::EqualEqual] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::Minus] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::Plus] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::Comma] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::Slash] = { ActionType::Reduce, 47 };
-		m_actionTable[63][TokenType::Asterisk] = { ActionType::Reduce, 47 };
-		m_actionTable[65][TokenType::Integer] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::Float] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::Bool] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::Minus] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::String] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::LeftParen] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::Identifier] = { ActionType::Reduce, 30 };
-		m_actionTable[65][TokenType::Bang] = { ActionType::Reduce, 30 };
-		m_actionTable[66][TokenType::Integer] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::Float] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::Bool] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::Minus] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::String] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::LeftParen] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::Identifier] = { ActionType::Reduce, 29 };
-		m_actionTable[66][TokenType::Bang] = { ActionType::Reduce, 29 };
-		m_actionTable[68][TokenType::RightCurly] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Else] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::_EOF] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::ElseIf] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Func] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Return] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::While] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::If] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Identifier] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Bool] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::String] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Float] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Integer] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::LeftParen] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Bang] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::Minus] = { ActionType::Reduce, 5 };
-		m_actionTable[68][TokenType::LeftCurly] = { ActionType::Reduce, 5 };
-		m_actionTable[71][TokenType::Semicolon] = { ActionType::Reduce, 21 };
-		m_actionTable[72][TokenType::Semicolon] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::LessThanEqual] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::OrOr] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::AndAnd] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::RightParen] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::GreaterThanEqual] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::LessThan] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::GreaterThan] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::NotEqual] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::EqualEqual] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::Minus] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::Plus] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::Comma] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::Slash] = { ActionType::Reduce, 43 };
-		m_actionTable[72][TokenType::Asterisk] = { ActionType::Reduce, 43 };
-		m_actionTable[77][TokenType::Semicolon] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::LessThanEqual] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::OrOr] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::AndAnd] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::LessThan] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::NotEqual] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::GreaterThanEqual] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::GreaterThan] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::EqualEqual] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::RightParen] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::Minus] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::Plus] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::Comma] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::Slash] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::Asterisk] = { ActionType::Reduce, 60 };
-		m_actionTable[77][TokenType::LeftParen] = { ActionType::Reduce, 60 };
-		m_actionTable[80][TokenType::Comma] = { ActionType::Reduce, 27 };
-		m_actionTable[80][TokenType::RightParen] = { ActionType::Reduce, 27 };
-		m_actionTable[80][TokenType::Semicolon] = { ActionType::Reduce, 27 };
-		m_actionTable[80][TokenType::AndAnd] = { ActionType::Reduce, 27 };
-		m_actionTable[80][TokenType::OrOr] = { ActionType::Reduce, 27 };
-		m_actionTable[81][TokenType::RightCurly] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Else] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::_EOF] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::ElseIf] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Func] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Return] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::While] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::If] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Identifier] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Bool] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::String] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Float] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Integer] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::LeftParen] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Bang] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::Minus] = { ActionType::Reduce, 4 };
-		m_actionTable[81][TokenType::LeftCurly] = { ActionType::Reduce, 4 };
-		m_actionTable[87][TokenType::Semicolon] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::LessThanEqual] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::OrOr] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::AndAnd] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::RightParen] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::GreaterThanEqual] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::LessThan] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::GreaterThan] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::NotEqual] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::EqualEqual] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::Minus] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::Plus] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::Comma] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::Slash] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::Asterisk] = { ActionType::Reduce, 51 };
-		m_actionTable[87][TokenType::LeftParen] = { ActionType::Reduce, 51 };
-		m_actionTable[88][TokenType::RightParen] = { ActionType::Reduce, 54 };
-		m_actionTable[91][TokenType::RightParen] = { ActionType::Reduce, 16 };
-		m_actionTable[93][TokenType::RightCurly] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Else] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::_EOF] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::ElseIf] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Func] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Return] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::While] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::If] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Identifier] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Bool] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::String] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Float] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Integer] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::LeftParen] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Bang] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::Minus] = { ActionType::Reduce, 24 };
-		m_actionTable[93][TokenType::LeftCurly] = { ActionType::Reduce, 24 };
-		m_actionTable[94][TokenType::RightCurly] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Else] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::_EOF] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::ElseIf] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Func] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Return] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::While] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::If] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Identifier] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Bool] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::String] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Float] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Integer] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::LeftParen] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Bang] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::Minus] = { ActionType::Reduce, 23 };
-		m_actionTable[94][TokenType::LeftCurly] = { ActionType::Reduce, 23 };
-		m_actionTable[95][TokenType::RightCurly] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Else] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::_EOF] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::ElseIf] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Func] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Return] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::While] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::If] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Identifier] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Bool] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::String] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Float] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Integer] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::LeftParen] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Bang] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::Minus] = { ActionType::Reduce, 22 };
-		m_actionTable[95][TokenType::LeftCurly] = { ActionType::Reduce, 22 };
-		m_actionTable[97][TokenType::RightCurly] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Else] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::_EOF] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::ElseIf] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Func] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Return] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::While] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::If] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Identifier] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Bool] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::String] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Float] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Integer] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::LeftParen] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Bang] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::Minus] = { ActionType::Reduce, 14 };
-		m_actionTable[97][TokenType::LeftCurly] = { ActionType::Reduce, 14 };
-		m_actionTable[99][TokenType::RightParen] = { ActionType::Reduce, 56 };
-		m_actionTable[100][TokenType::RightParen] = { ActionType::Reduce, 18 };
-		m_gotoTable[8][NodeType::FactorOp] = 45;
-		m_gotoTable[64][NodeType::Conditional] = 80;
-		m_gotoTable[64][NodeType::UnaryOp] = 25;
-		m_gotoTable[64][NodeType::Term] = 17;
-		m_gotoTable[64][NodeType::Identifier] = 41;
-		m_gotoTable[64][NodeType::Literal] = 21;
-		m_gotoTable[64][NodeType::Grouping] = 20;
-		m_gotoTable[64][NodeType::Call] = 23;
-		m_gotoTable[64][NodeType::Primary] = 22;
-		m_gotoTable[64][NodeType::Unary] = 26;
-		m_gotoTable[64][NodeType::Factor] = 8;
-		m_gotoTable[0][NodeType::File] = 1;
-		m_gotoTable[0][NodeType::WhileStatement] = 16;
-		m_gotoTable[0][NodeType::Term] = 17;
-		m_gotoTable[0][NodeType::Statements] = 2;
-		m_gotoTable[0][NodeType::Factor] = 8;
-		m_gotoTable[0][NodeType::Identifier] = 7;
-		m_gotoTable[0][NodeType::Literal] = 21;
-		m_gotoTable[0][NodeType::Grouping] = 20;
-		m_gotoTable[0][NodeType::Primary] = 22;
-		m_gotoTable[0][NodeType::Call] = 23;
-		m_gotoTable[0][NodeType::UnaryOp] = 25;
-		m_gotoTable[0][NodeType::Unary] = 26;
-		m_gotoTable[0][NodeType::Conditional] = 27;
-		m_gotoTable[0][NodeType::Logical] = 28;
-		m_gotoTable[0][NodeType::Expression] = 29;
-		m_gotoTable[0][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[0][NodeType::ReturnStatement] = 31;
-		m_gotoTable[0][NodeType::Statement] = 33;
-		m_gotoTable[0][NodeType::IfStatement] = 34;
-		m_gotoTable[0][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[0][NodeType::ElseStatement] = 36;
-		m_gotoTable[0][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[0][NodeType::Block] = 38;
-		m_gotoTable[18][NodeType::Expression] = 61;
-		m_gotoTable[18][NodeType::UnaryOp] = 25;
-		m_gotoTable[18][NodeType::Term] = 17;
-		m_gotoTable[18][NodeType::Identifier] = 41;
-		m_gotoTable[18][NodeType::Literal] = 21;
-		m_gotoTable[18][NodeType::Grouping] = 20;
-		m_gotoTable[18][NodeType::Call] = 23;
-		m_gotoTable[18][NodeType::Primary] = 22;
-		m_gotoTable[18][NodeType::Unary] = 26;
-		m_gotoTable[18][NodeType::Factor] = 8;
-		m_gotoTable[18][NodeType::Conditional] = 27;
-		m_gotoTable[18][NodeType::Logical] = 28;
-		m_gotoTable[2][NodeType::Block] = 39;
-		m_gotoTable[2][NodeType::Factor] = 8;
-		m_gotoTable[2][NodeType::Identifier] = 7;
-		m_gotoTable[2][NodeType::WhileStatement] = 16;
-		m_gotoTable[2][NodeType::Term] = 17;
-		m_gotoTable[2][NodeType::Literal] = 21;
-		m_gotoTable[2][NodeType::Grouping] = 20;
-		m_gotoTable[2][NodeType::Primary] = 22;
-		m_gotoTable[2][NodeType::Call] = 23;
-		m_gotoTable[2][NodeType::UnaryOp] = 25;
-		m_gotoTable[2][NodeType::Unary] = 26;
-		m_gotoTable[2][NodeType::Conditional] = 27;
-		m_gotoTable[2][NodeType::Logical] = 28;
-		m_gotoTable[2][NodeType::Expression] = 29;
-		m_gotoTable[2][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[2][NodeType::ReturnStatement] = 31;
-		m_gotoTable[2][NodeType::Statement] = 33;
-		m_gotoTable[2][NodeType::IfStatement] = 34;
-		m_gotoTable[2][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[2][NodeType::ElseStatement] = 36;
-		m_gotoTable[2][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[75][NodeType::FactorOp] = 45;
-		m_gotoTable[11][NodeType::Block] = 50;
-		m_gotoTable[11][NodeType::Factor] = 8;
-		m_gotoTable[11][NodeType::Identifier] = 7;
-		m_gotoTable[11][NodeType::WhileStatement] = 16;
-		m_gotoTable[11][NodeType::Term] = 17;
-		m_gotoTable[11][NodeType::Literal] = 21;
-		m_gotoTable[11][NodeType::Grouping] = 20;
-		m_gotoTable[11][NodeType::Primary] = 22;
-		m_gotoTable[11][NodeType::Call] = 23;
-		m_gotoTable[11][NodeType::UnaryOp] = 25;
-		m_gotoTable[11][NodeType::Unary] = 26;
-		m_gotoTable[11][NodeType::Conditional] = 27;
-		m_gotoTable[11][NodeType::Logical] = 28;
-		m_gotoTable[11][NodeType::Expression] = 29;
-		m_gotoTable[11][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[11][NodeType::ReturnStatement] = 31;
-		m_gotoTable[11][NodeType::Statement] = 33;
-		m_gotoTable[11][NodeType::IfStatement] = 34;
-		m_gotoTable[11][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[11][NodeType::ElseStatement] = 36;
-		m_gotoTable[11][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[67][NodeType::Block] = 39;
-		m_gotoTable[67][NodeType::Identifier] = 7;
-		m_gotoTable[67][NodeType::Factor] = 8;
-		m_gotoTable[67][NodeType::WhileStatement] = 16;
-		m_gotoTable[67][NodeType::Term] = 17;
-		m_gotoTable[67][NodeType::Literal] = 21;
-		m_gotoTable[67][NodeType::Grouping] = 20;
-		m_gotoTable[67][NodeType::Primary] = 22;
-		m_gotoTable[67][NodeType::Call] = 23;
-		m_gotoTable[67][NodeType::UnaryOp] = 25;
-		m_gotoTable[67][NodeType::Unary] = 26;
-		m_gotoTable[67][NodeType::Conditional] = 27;
-		m_gotoTable[67][NodeType::Logical] = 28;
-		m_gotoTable[67][NodeType::Expression] = 29;
-		m_gotoTable[67][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[67][NodeType::ReturnStatement] = 31;
-		m_gotoTable[67][NodeType::Statement] = 33;
-		m_gotoTable[67][NodeType::IfStatement] = 34;
-		m_gotoTable[67][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[67][NodeType::ElseStatement] = 36;
-		m_gotoTable[67][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[3][NodeType::Expression] = 40;
-		m_gotoTable[3][NodeType::UnaryOp] = 25;
-		m_gotoTable[3][NodeType::Term] = 17;
-		m_gotoTable[3][NodeType::Identifier] = 41;
-		m_gotoTable[3][NodeType::Literal] = 21;
-		m_gotoTable[3][NodeType::Grouping] = 20;
-		m_gotoTable[3][NodeType::Call] = 23;
-		m_gotoTable[3][NodeType::Primary] = 22;
-		m_gotoTable[3][NodeType::Unary] = 26;
-		m_gotoTable[3][NodeType::Factor] = 8;
-		m_gotoTable[3][NodeType::Conditional] = 27;
-		m_gotoTable[3][NodeType::Logical] = 28;
-		m_gotoTable[4][NodeType::Identifier] = 42;
-		m_gotoTable[17][NodeType::TermOp] = 52;
-		m_gotoTable[17][NodeType::ConditionalOp] = 54;
-		m_gotoTable[89][NodeType::Expression] = 96;
-		m_gotoTable[89][NodeType::UnaryOp] = 25;
-		m_gotoTable[89][NodeType::Term] = 17;
-		m_gotoTable[89][NodeType::Identifier] = 41;
-		m_gotoTable[89][NodeType::Literal] = 21;
-		m_gotoTable[89][NodeType::Grouping] = 20;
-		m_gotoTable[89][NodeType::Call] = 23;
-		m_gotoTable[89][NodeType::Primary] = 22;
-		m_gotoTable[89][NodeType::Unary] = 26;
-		m_gotoTable[89][NodeType::Factor] = 8;
-		m_gotoTable[89][NodeType::Conditional] = 27;
-		m_gotoTable[89][NodeType::Logical] = 28;
-		m_gotoTable[25][NodeType::Unary] = 63;
-		m_gotoTable[25][NodeType::Identifier] = 41;
-		m_gotoTable[25][NodeType::Literal] = 21;
-		m_gotoTable[25][NodeType::Grouping] = 20;
-		m_gotoTable[25][NodeType::Call] = 23;
-		m_gotoTable[25][NodeType::Primary] = 22;
-		m_gotoTable[25][NodeType::UnaryOp] = 25;
-		m_gotoTable[92][NodeType::Identifier] = 98;
-		m_gotoTable[28][NodeType::LogicalOp] = 64;
-		m_gotoTable[96][NodeType::ArgRecurse] = 99;
-		m_gotoTable[32][NodeType::WhileStatement] = 16;
-		m_gotoTable[32][NodeType::Term] = 17;
-		m_gotoTable[32][NodeType::Statements] = 67;
-		m_gotoTable[32][NodeType::Factor] = 8;
-		m_gotoTable[32][NodeType::Identifier] = 7;
-		m_gotoTable[32][NodeType::Literal] = 21;
-		m_gotoTable[32][NodeType::Grouping] = 20;
-		m_gotoTable[32][NodeType::Primary] = 22;
-		m_gotoTable[32][NodeType::Call] = 23;
-		m_gotoTable[32][NodeType::UnaryOp] = 25;
-		m_gotoTable[32][NodeType::Unary] = 26;
-		m_gotoTable[32][NodeType::Conditional] = 27;
-		m_gotoTable[32][NodeType::Logical] = 28;
-		m_gotoTable[32][NodeType::Expression] = 29;
-		m_gotoTable[32][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[32][NodeType::ReturnStatement] = 31;
-		m_gotoTable[32][NodeType::Statement] = 33;
-		m_gotoTable[32][NodeType::IfStatement] = 34;
-		m_gotoTable[32][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[32][NodeType::ElseStatement] = 36;
-		m_gotoTable[32][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[32][NodeType::Block] = 38;
-		m_gotoTable[43][NodeType::Expression] = 70;
-		m_gotoTable[43][NodeType::UnaryOp] = 25;
-		m_gotoTable[43][NodeType::Term] = 17;
-		m_gotoTable[43][NodeType::Identifier] = 41;
-		m_gotoTable[43][NodeType::Literal] = 21;
-		m_gotoTable[43][NodeType::Grouping] = 20;
-		m_gotoTable[43][NodeType::Call] = 23;
-		m_gotoTable[43][NodeType::Primary] = 22;
-		m_gotoTable[43][NodeType::Unary] = 26;
-		m_gotoTable[43][NodeType::Factor] = 8;
-		m_gotoTable[43][NodeType::Conditional] = 27;
-		m_gotoTable[43][NodeType::Logical] = 28;
-		m_gotoTable[44][NodeType::Expression] = 71;
-		m_gotoTable[44][NodeType::UnaryOp] = 25;
-		m_gotoTable[44][NodeType::Term] = 17;
-		m_gotoTable[44][NodeType::Identifier] = 41;
-		m_gotoTable[44][NodeType::Literal] = 21;
-		m_gotoTable[44][NodeType::Grouping] = 20;
-		m_gotoTable[44][NodeType::Call] = 23;
-		m_gotoTable[44][NodeType::Primary] = 22;
-		m_gotoTable[44][NodeType::Unary] = 26;
-		m_gotoTable[44][NodeType::Factor] = 8;
-		m_gotoTable[44][NodeType::Conditional] = 27;
-		m_gotoTable[44][NodeType::Logical] = 28;
-		m_gotoTable[45][NodeType::Unary] = 72;
-		m_gotoTable[45][NodeType::Identifier] = 41;
-		m_gotoTable[45][NodeType::Literal] = 21;
-		m_gotoTable[45][NodeType::Grouping] = 20;
-		m_gotoTable[45][NodeType::Call] = 23;
-		m_gotoTable[45][NodeType::Primary] = 22;
-		m_gotoTable[45][NodeType::UnaryOp] = 25;
-		m_gotoTable[48][NodeType::Expression] = 73;
-		m_gotoTable[48][NodeType::UnaryOp] = 25;
-		m_gotoTable[48][NodeType::Term] = 17;
-		m_gotoTable[48][NodeType::Identifier] = 41;
-		m_gotoTable[48][NodeType::Literal] = 21;
-		m_gotoTable[48][NodeType::Grouping] = 20;
-		m_gotoTable[48][NodeType::Call] = 23;
-		m_gotoTable[48][NodeType::Primary] = 22;
-		m_gotoTable[48][NodeType::Unary] = 26;
-		m_gotoTable[48][NodeType::Factor] = 8;
-		m_gotoTable[48][NodeType::Conditional] = 27;
-		m_gotoTable[48][NodeType::Logical] = 28;
-		m_gotoTable[49][NodeType::Expression] = 74;
-		m_gotoTable[49][NodeType::UnaryOp] = 25;
-		m_gotoTable[49][NodeType::Term] = 17;
-		m_gotoTable[49][NodeType::Identifier] = 41;
-		m_gotoTable[49][NodeType::Literal] = 21;
-		m_gotoTable[49][NodeType::Grouping] = 20;
-		m_gotoTable[49][NodeType::Call] = 23;
-		m_gotoTable[49][NodeType::Primary] = 22;
-		m_gotoTable[49][NodeType::Unary] = 26;
-		m_gotoTable[49][NodeType::Factor] = 8;
-		m_gotoTable[49][NodeType::Conditional] = 27;
-		m_gotoTable[49][NodeType::Logical] = 28;
-		m_gotoTable[52][NodeType::Factor] = 75;
-		m_gotoTable[52][NodeType::Identifier] = 41;
-		m_gotoTable[52][NodeType::Literal] = 21;
-		m_gotoTable[52][NodeType::Grouping] = 20;
-		m_gotoTable[52][NodeType::Call] = 23;
-		m_gotoTable[52][NodeType::Primary] = 22;
-		m_gotoTable[52][NodeType::UnaryOp] = 25;
-		m_gotoTable[52][NodeType::Unary] = 26;
-		m_gotoTable[54][NodeType::UnaryOp] = 25;
-		m_gotoTable[54][NodeType::Term] = 76;
-		m_gotoTable[54][NodeType::Identifier] = 41;
-		m_gotoTable[54][NodeType::Literal] = 21;
-		m_gotoTable[54][NodeType::Grouping] = 20;
-		m_gotoTable[54][NodeType::Call] = 23;
-		m_gotoTable[54][NodeType::Primary] = 22;
-		m_gotoTable[54][NodeType::Unary] = 26;
-		m_gotoTable[54][NodeType::Factor] = 8;
-		m_gotoTable[62][NodeType::UnaryOp] = 25;
-		m_gotoTable[62][NodeType::Arguments] = 78;
-		m_gotoTable[62][NodeType::Term] = 17;
-		m_gotoTable[62][NodeType::Identifier] = 41;
-		m_gotoTable[62][NodeType::Literal] = 21;
-		m_gotoTable[62][NodeType::Grouping] = 20;
-		m_gotoTable[62][NodeType::Call] = 23;
-		m_gotoTable[62][NodeType::Primary] = 22;
-		m_gotoTable[62][NodeType::Unary] = 26;
-		m_gotoTable[62][NodeType::Factor] = 8;
-		m_gotoTable[62][NodeType::Conditional] = 27;
-		m_gotoTable[62][NodeType::Logical] = 28;
-		m_gotoTable[62][NodeType::Expression] = 79;
-		m_gotoTable[69][NodeType::Parameters] = 82;
-		m_gotoTable[69][NodeType::Identifier] = 83;
-		m_gotoTable[76][NodeType::TermOp] = 52;
-		m_gotoTable[79][NodeType::ArgRecurse] = 88;
-		m_gotoTable[83][NodeType::ParamRecurse] = 91;
-		m_gotoTable[84][NodeType::Block] = 93;
-		m_gotoTable[84][NodeType::Factor] = 8;
-		m_gotoTable[84][NodeType::Identifier] = 7;
-		m_gotoTable[84][NodeType::WhileStatement] = 16;
-		m_gotoTable[84][NodeType::Term] = 17;
-		m_gotoTable[84][NodeType::Literal] = 21;
-		m_gotoTable[84][NodeType::Grouping] = 20;
-		m_gotoTable[84][NodeType::Primary] = 22;
-		m_gotoTable[84][NodeType::Call] = 23;
-		m_gotoTable[84][NodeType::UnaryOp] = 25;
-		m_gotoTable[84][NodeType::Unary] = 26;
-		m_gotoTable[84][NodeType::Conditional] = 27;
-		m_gotoTable[84][NodeType::Logical] = 28;
-		m_gotoTable[84][NodeType::Expression] = 29;
-		m_gotoTable[84][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[84][NodeType::ReturnStatement] = 31;
-		m_gotoTable[84][NodeType::Statement] = 33;
-		m_gotoTable[84][NodeType::IfStatement] = 34;
-		m_gotoTable[84][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[84][NodeType::ElseStatement] = 36;
-		m_gotoTable[84][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[85][NodeType::Block] = 94;
-		m_gotoTable[85][NodeType::Factor] = 8;
-		m_gotoTable[85][NodeType::Identifier] = 7;
-		m_gotoTable[85][NodeType::WhileStatement] = 16;
-		m_gotoTable[85][NodeType::Term] = 17;
-		m_gotoTable[85][NodeType::Literal] = 21;
-		m_gotoTable[85][NodeType::Grouping] = 20;
-		m_gotoTable[85][NodeType::Primary] = 22;
-		m_gotoTable[85][NodeType::Call] = 23;
-		m_gotoTable[85][NodeType::UnaryOp] = 25;
-		m_gotoTable[85][NodeType::Unary] = 26;
-		m_gotoTable[85][NodeType::Conditional] = 27;
-		m_gotoTable[85][NodeType::Logical] = 28;
-		m_gotoTable[85][NodeType::Expression] = 29;
-		m_gotoTable[85][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[85][NodeType::ReturnStatement] = 31;
-		m_gotoTable[85][NodeType::Statement] = 33;
-		m_gotoTable[85][NodeType::IfStatement] = 34;
-		m_gotoTable[85][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[85][NodeType::ElseStatement] = 36;
-		m_gotoTable[85][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[86][NodeType::Block] = 95;
-		m_gotoTable[86][NodeType::Factor] = 8;
-		m_gotoTable[86][NodeType::Identifier] = 7;
-		m_gotoTable[86][NodeType::WhileStatement] = 16;
-		m_gotoTable[86][NodeType::Term] = 17;
-		m_gotoTable[86][NodeType::Literal] = 21;
-		m_gotoTable[86][NodeType::Grouping] = 20;
-		m_gotoTable[86][NodeType::Primary] = 22;
-		m_gotoTable[86][NodeType::Call] = 23;
-		m_gotoTable[86][NodeType::UnaryOp] = 25;
-		m_gotoTable[86][NodeType::Unary] = 26;
-		m_gotoTable[86][NodeType::Conditional] = 27;
-		m_gotoTable[86][NodeType::Logical] = 28;
-		m_gotoTable[86][NodeType::Expression] = 29;
-		m_gotoTable[86][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[86][NodeType::ReturnStatement] = 31;
-		m_gotoTable[86][NodeType::Statement] = 33;
-		m_gotoTable[86][NodeType::IfStatement] = 34;
-		m_gotoTable[86][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[86][NodeType::ElseStatement] = 36;
-		m_gotoTable[86][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[90][NodeType::Block] = 97;
-		m_gotoTable[90][NodeType::Factor] = 8;
-		m_gotoTable[90][NodeType::Identifier] = 7;
-		m_gotoTable[90][NodeType::WhileStatement] = 16;
-		m_gotoTable[90][NodeType::Term] = 17;
-		m_gotoTable[90][NodeType::Literal] = 21;
-		m_gotoTable[90][NodeType::Grouping] = 20;
-		m_gotoTable[90][NodeType::Primary] = 22;
-		m_gotoTable[90][NodeType::Call] = 23;
-		m_gotoTable[90][NodeType::UnaryOp] = 25;
-		m_gotoTable[90][NodeType::Unary] = 26;
-		m_gotoTable[90][NodeType::Conditional] = 27;
-		m_gotoTable[90][NodeType::Logical] = 28;
-		m_gotoTable[90][NodeType::Expression] = 29;
-		m_gotoTable[90][NodeType::VarDeclareStatement] = 30;
-		m_gotoTable[90][NodeType::ReturnStatement] = 31;
-		m_gotoTable[90][NodeType::Statement] = 33;
-		m_gotoTable[90][NodeType::IfStatement] = 34;
-		m_gotoTable[90][NodeType::ElseIfStatement] = 35;
-		m_gotoTable[90][NodeType::ElseStatement] = 36;
-		m_gotoTable[90][NodeType::FunctionDeclareStatement] = 37;
-		m_gotoTable[98][NodeType::ParamRecurse] = 100;
-		m_grammar[0] = { NodeType::File, 1, 1, false };
-		m_grammar[1] = { NodeType::Statements, 2, 2, false };
-		m_grammar[2] = { NodeType::Statements, 1, 1, false };
-		m_grammar[3] = { NodeType::Block, 3, 1, false };
-		m_grammar[4] = { NodeType::Block, 2, 1, false };
-		m_grammar[5] = { NodeType::Block, 1, 1, false };
-		m_grammar[6] = { NodeType::Block, 1, 1, false };
-		m_grammar[7] = { NodeType::Block, 1, 1, false };
-		m_grammar[8] = { NodeType::Block, 1, 1, false };
-		m_grammar[9] = { NodeType::Block, 1, 1, false };
-		m_grammar[10] = { NodeType::Statement, 1, 1, false };
-		m_grammar[11] = { NodeType::Statement, 1, 1, false };
-		m_grammar[12] = { NodeType::Statement, 1, 1, false };
-		m_grammar[13] = { NodeType::FunctionDeclareStatement, 6, 3, false };
-		m_grammar[14] = { NodeType::Parameters, 0, 0, true };
-		m_grammar[15] = { NodeType::Parameters, 2, 2, false };
-		m_grammar[16] = { NodeType::ParamRecurse, 0, 0, true };
-		m_grammar[17] = { NodeType::ParamRecurse, 3, 2, false };
-		m_grammar[18] = { NodeType::ReturnStatement, 1, 0, true };
-		m_grammar[19] = { NodeType::ReturnStatement, 2, 1, false };
-		m_grammar[20] = { NodeType::VarDeclareStatement, 3, 2, false };
-		m_grammar[21] = { NodeType::WhileStatement, 5, 2, false };
-		m_grammar[22] = { NodeType::IfStatement, 5, 2, false };
-		m_grammar[23] = { NodeType::ElseIfStatement, 5, 2, false };
-		m_grammar[24] = { NodeType::ElseStatement, 2, 1, false };
-		m_grammar[25] = { NodeType::Expression, 1, 1, false };
-		m_grammar[26] = { NodeType::Logical, 3, 3, false };
-		m_grammar[27] = { NodeType::Logical, 1, 1, false };
-		m_grammar[28] = { NodeType::LogicalOp, 1, 0, true };
-		m_grammar[29] = { NodeType::LogicalOp, 1, 0, true };
-		m_grammar[30] = { NodeType::Conditional, 3, 3, false };
-		m_grammar[31] = { NodeType::Conditional, 1, 1, false };
-		m_grammar[32] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[33] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[34] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[35] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[36] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[37] = { NodeType::ConditionalOp, 1, 0, true };
-		m_grammar[38] = { NodeType::Term, 3, 3, false };
-		m_grammar[39] = { NodeType::Term, 1, 1, false };
-		m_grammar[40] = { NodeType::TermOp, 1, 0, true };
-		m_grammar[41] = { NodeType::TermOp, 1, 0, true };
-		m_grammar[42] = { NodeType::Factor, 3, 3, false };
-		m_grammar[43] = { NodeType::Factor, 1, 1, false };
-		m_grammar[44] = { NodeType::FactorOp, 1, 0, true };
-		m_grammar[45] = { NodeType::FactorOp, 1, 0, true };
-		m_grammar[46] = { NodeType::Unary, 2, 2, false };
-		m_grammar[47] = { NodeType::Unary, 1, 1, false };
-		m_grammar[48] = { NodeType::UnaryOp, 1, 0, true };
-		m_grammar[49] = { NodeType::UnaryOp, 1, 0, true };
-		m_grammar[50] = { NodeType::Call, 4, 2, false };
-		m_grammar[51] = { NodeType::Call, 1, 1, false };
-		m_grammar[52] = { NodeType::Arguments, 0, 0, true };
-		m_grammar[53] = { NodeType::Arguments, 2, 2, false };
-		m_grammar[54] = { NodeType::ArgRecurse, 0, 0, true };
-		m_grammar[55] = { NodeType::ArgRecurse, 3, 2, false };
-		m_grammar[56] = { NodeType::Primary, 1, 1, false };
-		m_grammar[57] = { NodeType::Primary, 1, 1, false };
-		m_grammar[58] = { NodeType::Primary, 1, 1, false };
-		m_grammar[59] = { NodeType::Grouping, 3, 1, false };
-		m_grammar[60] = { NodeType::Literal, 1, 0, true };
-		m_grammar[61] = { NodeType::Literal, 1, 0, true };
-		m_grammar[62] = { NodeType::Literal, 1, 0, true };
-		m_grammar[63] = { NodeType::Identifier, 1, 0, true };
-		m_grammar[64] = { NodeType::Literal, 1, 0, true };
+		ParseTree tree;
+		std::vector<Node> output;
+		// Rules that terminate take the token shifted last
+		Token lastToken;
+		run(tokens,
+			[&](const Token& token) { lastToken = token; },
+			[&](const Production& production, int)
+			{
+				// Only loaded tables can ask for nodes that were never made
+				if (output.size() < (size_t)production.rhsNodes)
+					corruptTables();
+				tree.reduce(output, production, lastToken);
+			});
+		if (output.empty())
+			corruptTables();
+		tree.nodes.push_back(output.back());
+		return tree;
+	}
+
+	// Runs the grammar's actions as the rules are reduced, no tree is built
+	template<typename TokenStream>
+	SemanticValue build(TokenStream& tokens)
+	{
+		std::vector<SemanticValue> values;
+		run(tokens,
+			[&](const Token& token) { values.push_back(token); },
+			[&](const Production& production, int rule)
+			{
+				if (production.passThrough)
+					return;
+				SemanticValue value = reduceAction(rule, values.data() + values.size() - production.rhs);
+				values.resize(values.size() - production.rhs);
+				values.push_back(std::move(value));
+			});
+		return std::move(values.back());
 	}
-	Node parse(std::vector<Token> tokens)
+
+	// Swaps in tables Peg wrote with -tables, so a grammar over the same tokens and
+	// node types can be run without a rebuild. The file is mapped and used in place.
+	// The rules' actions are compiled in, so only parse() works with loaded tables
+	bool loadTables(const char* path)
+	{
+		std::unique_ptr<LoadedTables> tables = std::make_unique<LoadedTables>();
+		if (!tables->file.open(path))
+			return tablesError(path, "does not exist!");
+		std::string_view data = tables->file.view();
+		TablesHeader header;
+		if (data.size() < sizeof(header) || std::memcmp(data.data(), "PEGT", 4) != 0)
+			return tablesError(path, "is not a table file");
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.version != TABLES_VERSION)
+			return tablesError(path, "was written for version " + std::to_string(header.version) + " of the table format, expected " + std::to_string(TABLES_VERSION));
+		// Bound the counts by the file first so the size below cannot overflow
+		if (header.namesSize > data.size() || (uint64_t)header.tokens + header.nodes > header.namesSize / 2 ||
+			header.states > data.size() / sizeof(Action) || header.rules > data.size() / (4 * sizeof(int32_t)))
+			return tablesError(path, "is the wrong size");
+		size_t size = sizeof(header) + header.namesSize + (size_t)header.rules * 4 * sizeof(int32_t) + (size_t)header.states * sizeof(Action) +
+			((size_t)header.states + 3) / 4 * 4 + (size_t)header.states * header.tokens * sizeof(Action) + (size_t)header.states * header.nodes * sizeof(int32_t);
+		if (data.size() != size || header.states == 0 || header.namesSize % 4 != 0)
+			return tablesError(path, "is the wrong size");
+
+		// Columns are matched to this parser's types by name
+		tables->tokenColumns.fill(-1);
+		tables->nodeColumns.fill(-1);
+		std::vector<NodeType> nodeTypes;
+		const char* names = data.data() + sizeof(header);
+		const char* namesEnd = names + header.namesSize;
+		for (uint32_t i = 0; i < header.tokens + header.nodes; i++)
+		{
+			const char* end = std::find(names, namesEnd, '\0');
+			if (end == namesEnd)
+				return tablesError(path, "is corrupt");
+			std::string_view name(names, end - names);
+			names = end + 1;
+			if (i < header.tokens)
+			{
+				auto token = std::find_if(std::begin(s_tokenNames), std::end(s_tokenNames), [&](const auto& pair) { return name == pair.first; });
+				if (token == std::end(s_tokenNames))
+					return tablesError(path, "uses the unknown token " + std::string(name));
+				tables->tokenColumns[(int)token->second] = (int)i;
+			}
+			else
+			{
+				auto node = std::find(std::begin(s_nodeNames), std::end(s_nodeNames), name);
+				if (node == std::end(s_nodeNames))
+					return tablesError(path, "uses the unknown node type " + std::string(name));
+				tables->nodeColumns[node - std::begin(s_nodeNames)] = (int)nodeTypes.size();
+				nodeTypes.push_back((NodeType)(node - std::begin(s_nodeNames)));
+			}
+		}
+
+		const int32_t* rules = (const int32_t*)namesEnd;
+		for (uint32_t i = 0; i < header.rules; i++)
+		{
+			const int32_t* rule = rules + i * 4;
+			// A rule terminates when it has no nodes and passes through a single node
+			bool terminates = (rule[3] & 1) != 0, passThrough = (rule[3] & 2) != 0;
+			if (rule[0] < 0 || rule[0] >= (int32_t)header.nodes || rule[1] < 0 || rule[2] < 0 || rule[2] > rule[1] ||
+				(rule[3] & ~3) != 0 || terminates != (rule[2] == 0) || (passThrough && (rule[1] != 1 || rule[2] != 1)))
+				return tablesError(path, "is corrupt");
+			tables->grammar.push_back({ nodeTypes[rule[0]], rule[1], rule[2], terminates, passThrough });
+		}
+		const char* next = (const char*)(rules + header.rules * 4);
+		tables->defaultActions = (const Action*)next;
+		next += header.states * sizeof(Action);
+		tables->reducesOnly = (const uint8_t*)next;
+		next += (header.states + 3) / 4 * 4;
+		tables->actions = (const Action*)next;
+		next += (size_t)header.states * header.tokens * sizeof(Action);
+		tables->gotos = (const int32_t*)next;
+
+		// Every state and rule the parse can reach is checked here once, so a bad
+		// file is turned away instead of being walked
+		auto validAction = [&](const Action& entry) {
+			switch (entry.type)
+			{
+			case ActionType::None:
+			case ActionType::Accept: return true;
+			case ActionType::Shift: return entry.value >= 0 && entry.value < (int)header.states;
+			case ActionType::Reduce: return entry.value >= 1 && entry.value <= (int)header.rules;
+			}
+			return false;
+		};
+		if (!std::all_of(tables->defaultActions, tables->defaultActions + header.states, validAction) ||
+			!std::all_of(tables->actions, tables->actions + (size_t)header.states * header.tokens, validAction) ||
+			!std::all_of(tables->gotos, tables->gotos + (size_t)header.states * header.nodes, [&](int32_t state) { return state >= 0 && state < (int32_t)header.states; }))
+			return tablesError(path, "is corrupt");
+		tables->tokens = header.tokens;
+		tables->nodes = header.nodes;
+		m_tables = std::move(tables);
+		return true;
+	}
+	inline bool hasLoadedTables() const { return m_tables != nullptr; }
+
+	// Table lookups for drivers that run the automaton themselves, e.g. the IncrementalParser
+	inline const Action& action(int state, TokenType type) const
+	{
+		if (m_tables)
+			return m_tables->action(state, type);
+		// States that reduce the same way on every token never look at it
+		if (s_reducesOnly[state])
+			return s_defaultActions[state];
+		const Action& entry = s_actionTable[state][(int)type];
+		return entry.type != ActionType::None ? entry : s_defaultActions[state];
+	}
+	inline int gotoState(int state, NodeType type) const { return m_tables ? m_tables->gotoState(state, type) : s_gotoTable[state][(int)type]; }
+	// Takes the value of a reduce action, rules are numbered from 1
+	inline const Production& production(int rule) const { return m_tables ? m_tables->grammar[rule - 1] : s_grammar[rule - 1]; }
+private:
+	using ActionTable = std::array<std::array<Action, TOKEN_NUM>, SET_NUM>;
+	using GotoTable = std::array<std::array<int, NODE_NUM>, SET_NUM>;
+
+	static constexpr Production s_grammar[GRAMMAR_NUM] = {
+		{ NodeType::File, 1, 1, false, true },
+		{ NodeType::Statements, 2, 2, false, false },
+		{ NodeType::Statements, 1, 1, false, false },
+		{ NodeType::Block, 3, 1, false, false },
+		{ NodeType::Block, 2, 1, false, false },
+		{ NodeType::Block, 1, 1, false, true },
+		{ NodeType::Block, 1, 1, false, true },
+		{ NodeType::Block, 1, 1, false, true },
+		{ NodeType::Block, 1, 1, false, true },
+		{ NodeType::Block, 1, 1, false, true },
+		{ NodeType::Statement, 1, 1, false, false },
+		{ NodeType::Statement, 1, 1, false, true },
+		{ NodeType::Statement, 1, 1, false, true },
+		{ NodeType::FunctionDeclareStatement, 6, 3, false, false },
+		{ NodeType::Parameters, 0, 0, true, false },
+		{ NodeType::Parameters, 2, 2, false, false },
+		{ NodeType::ParamRecurse, 0, 0, true, false },
+		{ NodeType::ParamRecurse, 3, 2, false, false },
+		{ NodeType::ReturnStatement, 1, 0, true, false },
+		{ NodeType::ReturnStatement, 2, 1, false, false },
+		{ NodeType::VarDeclareStatement, 3, 2, false, false },
+		{ NodeType::WhileStatement, 5, 2, false, false },
+		{ NodeType::IfStatement, 5, 2, false, false },
+		{ NodeType::ElseIfStatement, 5, 2, false, false },
+		{ NodeType::ElseStatement, 2, 1, false, false },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Expression, 1, 1, false, true },
+		{ NodeType::Logical, 3, 3, false, false },
+		{ NodeType::LogicalOp, 1, 0, true, false },
+		{ NodeType::LogicalOp, 1, 0, true, false },
+		{ NodeType::Conditional, 3, 3, false, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::ConditionalOp, 1, 0, true, false },
+		{ NodeType::Term, 3, 3, false, false },
+		{ NodeType::TermOp, 1, 0, true, false },
+		{ NodeType::TermOp, 1, 0, true, false },
+		{ NodeType::Factor, 3, 3, false, false },
+		{ NodeType::FactorOp, 1, 0, true, false },
+		{ NodeType::FactorOp, 1, 0, true, false },
+		{ NodeType::Unary, 2, 2, false, false },
+		{ NodeType::UnaryOp, 1, 0, true, false },
+		{ NodeType::UnaryOp, 1, 0, true, false },
+		{ NodeType::Call, 4, 2, false, false },
+		{ NodeType::Arguments, 0, 0, true, false },
+		{ NodeType::Arguments, 2, 2, false, false },
+		{ NodeType::ArgRecurse, 0, 0, true, false },
+		{ NodeType::ArgRecurse, 3, 2, false, false },
+		{ NodeType::Primary, 1, 1, false, false },
+		{ NodeType::Primary, 1, 1, false, true },
+		{ NodeType::Primary, 1, 1, false, true },
+		{ NodeType::Grouping, 3, 1, false, false },
+		{ NodeType::Literal, 1, 0, true, false },
+		{ NodeType::Literal, 1, 0, true, false },
+		{ NodeType::Literal, 1, 0, true, false },
+		{ NodeType::Identifier, 1, 0, true, false },
+		{ NodeType::Literal, 1, 0, true, false },
+	};
+	static constexpr Action s_defaultActions[SET_NUM] = {
+		{},
+		{},
+		{ ActionType::Reduce, 1 },
+		{ ActionType::Reduce, 3 },
+		{},
+		{},
+		{ ActionType::Reduce, 6 },
+		{ ActionType::Reduce, 7 },
+		{ ActionType::Reduce, 8 },
+		{ ActionType::Reduce, 9 },
+		{ ActionType::Reduce, 10 },
+		{},
+		{},
+		{},
+		{},
+		{},
+		{ ActionType::Reduce, 11 },
+		{ ActionType::Reduce, 12 },
+		{ ActionType::Reduce, 13 },
+		{ ActionType::Reduce, 19 },
+		{ ActionType::Reduce, 57 },
+		{ ActionType::Reduce, 64 },
+		{ ActionType::Reduce, 26 },
+		{ ActionType::Reduce, 27 },
+		{ ActionType::Reduce, 28 },
+		{ ActionType::Reduce, 29 },
+		{ ActionType::Reduce, 30 },
+		{ ActionType::Reduce, 31 },
+		{ ActionType::Reduce, 32 },
+		{ ActionType::Reduce, 58 },
+		{ ActionType::Reduce, 59 },
+		{ ActionType::Reduce, 61 },
+		{ ActionType::Reduce, 62 },
+		{ ActionType::Reduce, 63 },
+		{ ActionType::Reduce, 65 },
+		{},
+		{},
+		{ ActionType::Reduce, 50 },
+		{ ActionType::Reduce, 51 },
+		{ ActionType::Reduce, 2 },
+		{},
+		{ ActionType::Reduce, 5 },
+		{},
+		{},
+		{ ActionType::Reduce, 25 },
+		{},
+		{},
+		{},
+		{},
+		{},
+		{},
+		{ ActionType::Reduce, 53 },
+		{ ActionType::Reduce, 34 },
+		{ ActionType::Reduce, 35 },
+		{ ActionType::Reduce, 37 },
+		{ ActionType::Reduce, 38 },
+		{ ActionType::Reduce, 39 },
+		{ ActionType::Reduce, 40 },
+		{ ActionType::Reduce, 41 },
+		{ ActionType::Reduce, 42 },
+		{ ActionType::Reduce, 44 },
+		{ ActionType::Reduce, 45 },
+		{ ActionType::Reduce, 47 },
+		{ ActionType::Reduce, 48 },
+		{ ActionType::Reduce, 20 },
+		{ ActionType::Reduce, 57 },
+		{},
+		{},
+		{ ActionType::Reduce, 49 },
+		{ ActionType::Reduce, 4 },
+		{ ActionType::Reduce, 15 },
+		{},
+		{},
+		{},
+		{ ActionType::Reduce, 33 },
+		{},
+		{ ActionType::Reduce, 43 },
+		{ ActionType::Reduce, 46 },
+		{},
+		{ ActionType::Reduce, 55 },
+		{ ActionType::Reduce, 21 },
+		{ ActionType::Reduce, 60 },
+		{},
+		{ ActionType::Reduce, 17 },
+		{},
+		{},
+		{},
+		{ ActionType::Reduce, 52 },
+		{ ActionType::Reduce, 54 },
+		{},
+		{},
+		{ ActionType::Reduce, 16 },
+		{},
+		{ ActionType::Reduce, 22 },
+		{ ActionType::Reduce, 24 },
+		{ ActionType::Reduce, 23 },
+		{ ActionType::Reduce, 55 },
+		{ ActionType::Reduce, 14 },
+		{ ActionType::Reduce, 17 },
+		{ ActionType::Reduce, 56 },
+		{ ActionType::Reduce, 18 },
+	};
+	static constexpr bool s_reducesOnly[SET_NUM] = {
+		false, false, false, true, false, false, true, true, true, true, true, false, false, false, false, false,
+		false, true, true, false, false, true, true, true, true, true, true, true, true, true, true, true,
+		true, true, true, false, false, true, true, true, false, true, false, false, true, false, false, false,
+		false, false, false, false, true, true, true, true, true, true, true, true, true, true, true, true,
+		false, true, false, false, false, true, false, false, false, false, false, false, false, false, false, false,
+		false, true, false, false, false, false, false, true, true, false, false, true, false, true, true, true,
+		false, true, false, true, true,
+	};
+	static constexpr ActionTable s_actionTable = [] {
+		ActionTable table{};
+		table[0][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[0][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[0][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[0][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[0][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[0][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[0][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[0][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[0][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[0][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[0][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[0][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[0][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[0][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[0][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[1][(int)TokenType::_EOF] = { ActionType::Accept };
+		table[2][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[2][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[2][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[2][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[2][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[2][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[2][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[2][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[2][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[2][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[2][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[2][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[2][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[2][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[2][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[4][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[4][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[4][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[4][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[4][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[4][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[4][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[4][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[4][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[4][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[4][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[4][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[4][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[4][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[4][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[5][(int)TokenType::Semicolon] = { ActionType::Shift, 41 };
+		table[11][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[12][(int)TokenType::LeftParen] = { ActionType::Shift, 43 };
+		table[13][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[13][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[13][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[13][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[13][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[13][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[13][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[13][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[13][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[13][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[13][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[13][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[13][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[13][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[13][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[14][(int)TokenType::LeftParen] = { ActionType::Shift, 45 };
+		table[15][(int)TokenType::LeftParen] = { ActionType::Shift, 46 };
+		table[16][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[16][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[16][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[16][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[16][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[16][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[16][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[16][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[16][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[16][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[16][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[16][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[16][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[19][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[19][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[19][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[19][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[19][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[19][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[19][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[19][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[20][(int)TokenType::Equal] = { ActionType::Shift, 66 };
+		table[35][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[35][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[35][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[35][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[35][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[35][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[35][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[35][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[36][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[36][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[36][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[36][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[36][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[36][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[36][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[36][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[40][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[40][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[40][(int)TokenType::RightCurly] = { ActionType::Shift, 69 };
+		table[40][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[40][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[40][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[40][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[40][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[40][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[40][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[40][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[40][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[40][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[40][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[40][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[40][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[42][(int)TokenType::LeftParen] = { ActionType::Shift, 70 };
+		table[43][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[43][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[43][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[43][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[43][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[43][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[43][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[43][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[45][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[45][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[45][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[45][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[45][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[45][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[45][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[45][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[46][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[46][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[46][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[46][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[46][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[46][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[46][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[46][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[47][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[47][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[47][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[47][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[47][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[47][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[47][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[47][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[48][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[48][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[48][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[48][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[48][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[48][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[48][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[48][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[49][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[49][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[49][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[49][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[49][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[49][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[49][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[49][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[50][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[50][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[50][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[50][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[50][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[50][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[50][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[50][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[51][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[51][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[51][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[51][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[51][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[51][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[51][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[51][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[64][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[64][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[64][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[64][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[64][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[64][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[64][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[64][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[64][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[64][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[64][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[64][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[64][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[66][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[66][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[66][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[66][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[66][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[66][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[66][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[66][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[67][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[67][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[67][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[67][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[67][(int)TokenType::RightParen] = { ActionType::Shift, 81 };
+		table[67][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[67][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[67][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[67][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[67][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[67][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[67][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[67][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[67][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[68][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[70][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[71][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[71][(int)TokenType::RightParen] = { ActionType::Shift, 84 };
+		table[71][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[71][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[71][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[71][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[71][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[71][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[71][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[71][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[71][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[71][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[71][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[71][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[72][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[72][(int)TokenType::RightParen] = { ActionType::Shift, 85 };
+		table[72][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[72][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[72][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[72][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[72][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[72][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[72][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[72][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[72][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[72][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[72][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[72][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[73][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[73][(int)TokenType::RightParen] = { ActionType::Shift, 86 };
+		table[73][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[73][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[73][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[73][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[73][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[73][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[73][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[73][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[73][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[73][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[73][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[73][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[74][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[74][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[74][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[74][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[74][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[74][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[74][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[74][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[74][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[74][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[74][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[75][(int)TokenType::RightParen] = { ActionType::Reduce, 36 };
+		table[75][(int)TokenType::Semicolon] = { ActionType::Reduce, 36 };
+		table[75][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[75][(int)TokenType::AndAnd] = { ActionType::Reduce, 36 };
+		table[75][(int)TokenType::OrOr] = { ActionType::Reduce, 36 };
+		table[75][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[75][(int)TokenType::Comma] = { ActionType::Reduce, 36 };
+		table[75][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[75][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[75][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[76][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[76][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[76][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[77][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[78][(int)TokenType::RightParen] = { ActionType::Shift, 87 };
+		table[79][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[79][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[79][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[79][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[79][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[79][(int)TokenType::Comma] = { ActionType::Shift, 89 };
+		table[79][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[79][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[79][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[79][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[79][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[79][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[79][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[79][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[80][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[80][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[80][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[80][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[80][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[80][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[80][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[80][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[80][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[80][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[80][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[80][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[80][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[82][(int)TokenType::RightParen] = { ActionType::Shift, 90 };
+		table[83][(int)TokenType::Comma] = { ActionType::Shift, 92 };
+		table[84][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[84][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[84][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[84][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[84][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[84][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[84][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[84][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[84][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[84][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[84][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[84][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[84][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[84][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[84][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[85][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[85][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[85][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[85][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[85][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[85][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[85][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[85][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[85][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[85][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[85][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[85][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[85][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[85][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[85][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[86][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[86][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[86][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[86][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[86][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[86][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[86][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[86][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[86][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[86][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[86][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[86][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[86][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[86][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[86][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[89][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[89][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[89][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[89][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[89][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[89][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[89][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[89][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[90][(int)TokenType::Bang] = { ActionType::Shift, 38 };
+		table[90][(int)TokenType::Minus] = { ActionType::Shift, 37 };
+		table[90][(int)TokenType::LeftCurly] = { ActionType::Shift, 4 };
+		table[90][(int)TokenType::Func] = { ActionType::Shift, 11 };
+		table[90][(int)TokenType::While] = { ActionType::Shift, 12 };
+		table[90][(int)TokenType::Return] = { ActionType::Shift, 19 };
+		table[90][(int)TokenType::Float] = { ActionType::Shift, 32 };
+		table[90][(int)TokenType::ElseIf] = { ActionType::Shift, 14 };
+		table[90][(int)TokenType::String] = { ActionType::Shift, 33 };
+		table[90][(int)TokenType::If] = { ActionType::Shift, 15 };
+		table[90][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[90][(int)TokenType::Integer] = { ActionType::Shift, 31 };
+		table[90][(int)TokenType::Bool] = { ActionType::Shift, 34 };
+		table[90][(int)TokenType::Else] = { ActionType::Shift, 13 };
+		table[90][(int)TokenType::LeftParen] = { ActionType::Shift, 35 };
+		table[92][(int)TokenType::Identifier] = { ActionType::Shift, 21 };
+		table[96][(int)TokenType::LeftParen] = { ActionType::Shift, 51 };
+		table[96][(int)TokenType::AndAnd] = { ActionType::Shift, 52 };
+		table[96][(int)TokenType::OrOr] = { ActionType::Shift, 53 };
+		table[96][(int)TokenType::EqualEqual] = { ActionType::Shift, 54 };
+		table[96][(int)TokenType::Plus] = { ActionType::Shift, 60 };
+		table[96][(int)TokenType::Comma] = { ActionType::Shift, 89 };
+		table[96][(int)TokenType::LessThan] = { ActionType::Shift, 58 };
+		table[96][(int)TokenType::Asterisk] = { ActionType::Shift, 62 };
+		table[96][(int)TokenType::NotEqual] = { ActionType::Shift, 55 };
+		table[96][(int)TokenType::GreaterThan] = { ActionType::Shift, 56 };
+		table[96][(int)TokenType::GreaterThanEqual] = { ActionType::Shift, 57 };
+		table[96][(int)TokenType::LessThanEqual] = { ActionType::Shift, 59 };
+		table[96][(int)TokenType::Minus] = { ActionType::Shift, 61 };
+		table[96][(int)TokenType::Slash] = { ActionType::Shift, 63 };
+		table[98][(int)TokenType::Comma] = { ActionType::Shift, 92 };
+		return table;
+	}();
+	static constexpr GotoTable s_gotoTable = [] {
+		GotoTable table{};
+		table[0][(int)NodeType::UnaryOp] = 36;
+		table[0][(int)NodeType::Grouping] = 29;
+		table[0][(int)NodeType::Call] = 27;
+		table[0][(int)NodeType::Primary] = 28;
+		table[0][(int)NodeType::Unary] = 26;
+		table[0][(int)NodeType::Literal] = 30;
+		table[0][(int)NodeType::Factor] = 25;
+		table[0][(int)NodeType::Term] = 24;
+		table[0][(int)NodeType::File] = 1;
+		table[0][(int)NodeType::Block] = 3;
+		table[0][(int)NodeType::Statement] = 5;
+		table[0][(int)NodeType::Expression] = 16;
+		table[0][(int)NodeType::IfStatement] = 6;
+		table[0][(int)NodeType::Logical] = 22;
+		table[0][(int)NodeType::ElseIfStatement] = 7;
+		table[0][(int)NodeType::Conditional] = 23;
+		table[0][(int)NodeType::VarDeclareStatement] = 17;
+		table[0][(int)NodeType::ElseStatement] = 8;
+		table[0][(int)NodeType::WhileStatement] = 9;
+		table[0][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[0][(int)NodeType::ReturnStatement] = 18;
+		table[0][(int)NodeType::Statements] = 2;
+		table[0][(int)NodeType::Identifier] = 20;
+		table[2][(int)NodeType::UnaryOp] = 36;
+		table[2][(int)NodeType::Grouping] = 29;
+		table[2][(int)NodeType::Call] = 27;
+		table[2][(int)NodeType::Primary] = 28;
+		table[2][(int)NodeType::Unary] = 26;
+		table[2][(int)NodeType::Literal] = 30;
+		table[2][(int)NodeType::Factor] = 25;
+		table[2][(int)NodeType::Term] = 24;
+		table[2][(int)NodeType::Block] = 39;
+		table[2][(int)NodeType::Statement] = 5;
+		table[2][(int)NodeType::Expression] = 16;
+		table[2][(int)NodeType::IfStatement] = 6;
+		table[2][(int)NodeType::VarDeclareStatement] = 17;
+		table[2][(int)NodeType::Conditional] = 23;
+		table[2][(int)NodeType::ElseStatement] = 8;
+		table[2][(int)NodeType::WhileStatement] = 9;
+		table[2][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[2][(int)NodeType::ReturnStatement] = 18;
+		table[2][(int)NodeType::ElseIfStatement] = 7;
+		table[2][(int)NodeType::Logical] = 22;
+		table[2][(int)NodeType::Identifier] = 20;
+		table[4][(int)NodeType::UnaryOp] = 36;
+		table[4][(int)NodeType::Grouping] = 29;
+		table[4][(int)NodeType::Call] = 27;
+		table[4][(int)NodeType::Primary] = 28;
+		table[4][(int)NodeType::Unary] = 26;
+		table[4][(int)NodeType::Literal] = 30;
+		table[4][(int)NodeType::Factor] = 25;
+		table[4][(int)NodeType::Term] = 24;
+		table[4][(int)NodeType::Block] = 3;
+		table[4][(int)NodeType::Statement] = 5;
+		table[4][(int)NodeType::Expression] = 16;
+		table[4][(int)NodeType::IfStatement] = 6;
+		table[4][(int)NodeType::Conditional] = 23;
+		table[4][(int)NodeType::VarDeclareStatement] = 17;
+		table[4][(int)NodeType::ElseStatement] = 8;
+		table[4][(int)NodeType::WhileStatement] = 9;
+		table[4][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[4][(int)NodeType::ReturnStatement] = 18;
+		table[4][(int)NodeType::ElseIfStatement] = 7;
+		table[4][(int)NodeType::Logical] = 22;
+		table[4][(int)NodeType::Statements] = 40;
+		table[4][(int)NodeType::Identifier] = 20;
+		table[11][(int)NodeType::Identifier] = 42;
+		table[13][(int)NodeType::UnaryOp] = 36;
+		table[13][(int)NodeType::Grouping] = 29;
+		table[13][(int)NodeType::Call] = 27;
+		table[13][(int)NodeType::Primary] = 28;
+		table[13][(int)NodeType::Unary] = 26;
+		table[13][(int)NodeType::Literal] = 30;
+		table[13][(int)NodeType::Factor] = 25;
+		table[13][(int)NodeType::Term] = 24;
+		table[13][(int)NodeType::Block] = 44;
+		table[13][(int)NodeType::Statement] = 5;
+		table[13][(int)NodeType::Expression] = 16;
+		table[13][(int)NodeType::IfStatement] = 6;
+		table[13][(int)NodeType::VarDeclareStatement] = 17;
+		table[13][(int)NodeType::Conditional] = 23;
+		table[13][(int)NodeType::ElseStatement] = 8;
+		table[13][(int)NodeType::WhileStatement] = 9;
+		table[13][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[13][(int)NodeType::ReturnStatement] = 18;
+		table[13][(int)NodeType::ElseIfStatement] = 7;
+		table[13][(int)NodeType::Logical] = 22;
+		table[13][(int)NodeType::Identifier] = 20;
+		table[16][(int)NodeType::FactorOp] = 50;
+		table[16][(int)NodeType::TermOp] = 49;
+		table[16][(int)NodeType::ConditionalOp] = 48;
+		table[16][(int)NodeType::LogicalOp] = 47;
+		table[19][(int)NodeType::UnaryOp] = 36;
+		table[19][(int)NodeType::Literal] = 30;
+		table[19][(int)NodeType::Primary] = 28;
+		table[19][(int)NodeType::Grouping] = 29;
+		table[19][(int)NodeType::Call] = 27;
+		table[19][(int)NodeType::Unary] = 26;
+		table[19][(int)NodeType::Factor] = 25;
+		table[19][(int)NodeType::Identifier] = 65;
+		table[19][(int)NodeType::Term] = 24;
+		table[19][(int)NodeType::Conditional] = 23;
+		table[19][(int)NodeType::Logical] = 22;
+		table[19][(int)NodeType::Expression] = 64;
+		table[35][(int)NodeType::UnaryOp] = 36;
+		table[35][(int)NodeType::Literal] = 30;
+		table[35][(int)NodeType::Primary] = 28;
+		table[35][(int)NodeType::Grouping] = 29;
+		table[35][(int)NodeType::Call] = 27;
+		table[35][(int)NodeType::Unary] = 26;
+		table[35][(int)NodeType::Factor] = 25;
+		table[35][(int)NodeType::Identifier] = 65;
+		table[35][(int)NodeType::Term] = 24;
+		table[35][(int)NodeType::Conditional] = 23;
+		table[35][(int)NodeType::Logical] = 22;
+		table[35][(int)NodeType::Expression] = 67;
+		table[36][(int)NodeType::UnaryOp] = 36;
+		table[36][(int)NodeType::Literal] = 30;
+		table[36][(int)NodeType::Primary] = 28;
+		table[36][(int)NodeType::Grouping] = 29;
+		table[36][(int)NodeType::Call] = 27;
+		table[36][(int)NodeType::Unary] = 26;
+		table[36][(int)NodeType::Factor] = 25;
+		table[36][(int)NodeType::Identifier] = 65;
+		table[36][(int)NodeType::Term] = 24;
+		table[36][(int)NodeType::Conditional] = 23;
+		table[36][(int)NodeType::Logical] = 22;
+		table[36][(int)NodeType::Expression] = 68;
+		table[40][(int)NodeType::UnaryOp] = 36;
+		table[40][(int)NodeType::Grouping] = 29;
+		table[40][(int)NodeType::Call] = 27;
+		table[40][(int)NodeType::Primary] = 28;
+		table[40][(int)NodeType::Unary] = 26;
+		table[40][(int)NodeType::Literal] = 30;
+		table[40][(int)NodeType::Factor] = 25;
+		table[40][(int)NodeType::Term] = 24;
+		table[40][(int)NodeType::Block] = 39;
+		table[40][(int)NodeType::Statement] = 5;
+		table[40][(int)NodeType::Expression] = 16;
+		table[40][(int)NodeType::IfStatement] = 6;
+		table[40][(int)NodeType::VarDeclareStatement] = 17;
+		table[40][(int)NodeType::Conditional] = 23;
+		table[40][(int)NodeType::ElseStatement] = 8;
+		table[40][(int)NodeType::WhileStatement] = 9;
+		table[40][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[40][(int)NodeType::ReturnStatement] = 18;
+		table[40][(int)NodeType::ElseIfStatement] = 7;
+		table[40][(int)NodeType::Logical] = 22;
+		table[40][(int)NodeType::Identifier] = 20;
+		table[43][(int)NodeType::UnaryOp] = 36;
+		table[43][(int)NodeType::Literal] = 30;
+		table[43][(int)NodeType::Primary] = 28;
+		table[43][(int)NodeType::Grouping] = 29;
+		table[43][(int)NodeType::Call] = 27;
+		table[43][(int)NodeType::Unary] = 26;
+		table[43][(int)NodeType::Factor] = 25;
+		table[43][(int)NodeType::Identifier] = 65;
+		table[43][(int)NodeType::Term] = 24;
+		table[43][(int)NodeType::Conditional] = 23;
+		table[43][(int)NodeType::Logical] = 22;
+		table[43][(int)NodeType::Expression] = 71;
+		table[45][(int)NodeType::UnaryOp] = 36;
+		table[45][(int)NodeType::Literal] = 30;
+		table[45][(int)NodeType::Primary] = 28;
+		table[45][(int)NodeType::Grouping] = 29;
+		table[45][(int)NodeType::Call] = 27;
+		table[45][(int)NodeType::Unary] = 26;
+		table[45][(int)NodeType::Factor] = 25;
+		table[45][(int)NodeType::Identifier] = 65;
+		table[45][(int)NodeType::Term] = 24;
+		table[45][(int)NodeType::Conditional] = 23;
+		table[45][(int)NodeType::Logical] = 22;
+		table[45][(int)NodeType::Expression] = 72;
+		table[46][(int)NodeType::UnaryOp] = 36;
+		table[46][(int)NodeType::Literal] = 30;
+		table[46][(int)NodeType::Primary] = 28;
+		table[46][(int)NodeType::Grouping] = 29;
+		table[46][(int)NodeType::Call] = 27;
+		table[46][(int)NodeType::Unary] = 26;
+		table[46][(int)NodeType::Factor] = 25;
+		table[46][(int)NodeType::Identifier] = 65;
+		table[46][(int)NodeType::Term] = 24;
+		table[46][(int)NodeType::Conditional] = 23;
+		table[46][(int)NodeType::Logical] = 22;
+		table[46][(int)NodeType::Expression] = 73;
+		table[47][(int)NodeType::UnaryOp] = 36;
+		table[47][(int)NodeType::Literal] = 30;
+		table[47][(int)NodeType::Primary] = 28;
+		table[47][(int)NodeType::Grouping] = 29;
+		table[47][(int)NodeType::Call] = 27;
+		table[47][(int)NodeType::Unary] = 26;
+		table[47][(int)NodeType::Factor] = 25;
+		table[47][(int)NodeType::Identifier] = 65;
+		table[47][(int)NodeType::Term] = 24;
+		table[47][(int)NodeType::Conditional] = 23;
+		table[47][(int)NodeType::Logical] = 22;
+		table[47][(int)NodeType::Expression] = 74;
+		table[48][(int)NodeType::UnaryOp] = 36;
+		table[48][(int)NodeType::Literal] = 30;
+		table[48][(int)NodeType::Primary] = 28;
+		table[48][(int)NodeType::Grouping] = 29;
+		table[48][(int)NodeType::Call] = 27;
+		table[48][(int)NodeType::Unary] = 26;
+		table[48][(int)NodeType::Factor] = 25;
+		table[48][(int)NodeType::Identifier] = 65;
+		table[48][(int)NodeType::Term] = 24;
+		table[48][(int)NodeType::Conditional] = 23;
+		table[48][(int)NodeType::Logical] = 22;
+		table[48][(int)NodeType::Expression] = 75;
+		table[49][(int)NodeType::UnaryOp] = 36;
+		table[49][(int)NodeType::Literal] = 30;
+		table[49][(int)NodeType::Primary] = 28;
+		table[49][(int)NodeType::Grouping] = 29;
+		table[49][(int)NodeType::Call] = 27;
+		table[49][(int)NodeType::Unary] = 26;
+		table[49][(int)NodeType::Factor] = 25;
+		table[49][(int)NodeType::Identifier] = 65;
+		table[49][(int)NodeType::Term] = 24;
+		table[49][(int)NodeType::Conditional] = 23;
+		table[49][(int)NodeType::Logical] = 22;
+		table[49][(int)NodeType::Expression] = 76;
+		table[50][(int)NodeType::UnaryOp] = 36;
+		table[50][(int)NodeType::Literal] = 30;
+		table[50][(int)NodeType::Primary] = 28;
+		table[50][(int)NodeType::Grouping] = 29;
+		table[50][(int)NodeType::Call] = 27;
+		table[50][(int)NodeType::Unary] = 26;
+		table[50][(int)NodeType::Factor] = 25;
+		table[50][(int)NodeType::Identifier] = 65;
+		table[50][(int)NodeType::Term] = 24;
+		table[50][(int)NodeType::Conditional] = 23;
+		table[50][(int)NodeType::Logical] = 22;
+		table[50][(int)NodeType::Expression] = 77;
+		table[51][(int)NodeType::UnaryOp] = 36;
+		table[51][(int)NodeType::Primary] = 28;
+		table[51][(int)NodeType::Grouping] = 29;
+		table[51][(int)NodeType::Call] = 27;
+		table[51][(int)NodeType::Unary] = 26;
+		table[51][(int)NodeType::Factor] = 25;
+		table[51][(int)NodeType::Identifier] = 65;
+		table[51][(int)NodeType::Term] = 24;
+		table[51][(int)NodeType::Conditional] = 23;
+		table[51][(int)NodeType::Logical] = 22;
+		table[51][(int)NodeType::Expression] = 79;
+		table[51][(int)NodeType::Literal] = 30;
+		table[51][(int)NodeType::Arguments] = 78;
+		table[64][(int)NodeType::FactorOp] = 50;
+		table[64][(int)NodeType::TermOp] = 49;
+		table[64][(int)NodeType::ConditionalOp] = 48;
+		table[64][(int)NodeType::LogicalOp] = 47;
+		table[66][(int)NodeType::UnaryOp] = 36;
+		table[66][(int)NodeType::Literal] = 30;
+		table[66][(int)NodeType::Primary] = 28;
+		table[66][(int)NodeType::Grouping] = 29;
+		table[66][(int)NodeType::Call] = 27;
+		table[66][(int)NodeType::Unary] = 26;
+		table[66][(int)NodeType::Factor] = 25;
+		table[66][(int)NodeType::Identifier] = 65;
+		table[66][(int)NodeType::Term] = 24;
+		table[66][(int)NodeType::Conditional] = 23;
+		table[66][(int)NodeType::Logical] = 22;
+		table[66][(int)NodeType::Expression] = 80;
+		table[67][(int)NodeType::FactorOp] = 50;
+		table[67][(int)NodeType::TermOp] = 49;
+		table[67][(int)NodeType::ConditionalOp] = 48;
+		table[67][(int)NodeType::LogicalOp] = 47;
+		table[68][(int)NodeType::FactorOp] = 50;
+		table[68][(int)NodeType::TermOp] = 49;
+		table[68][(int)NodeType::ConditionalOp] = 48;
+		table[68][(int)NodeType::LogicalOp] = 47;
+		table[70][(int)NodeType::Identifier] = 83;
+		table[70][(int)NodeType::Parameters] = 82;
+		table[71][(int)NodeType::FactorOp] = 50;
+		table[71][(int)NodeType::TermOp] = 49;
+		table[71][(int)NodeType::ConditionalOp] = 48;
+		table[71][(int)NodeType::LogicalOp] = 47;
+		table[72][(int)NodeType::FactorOp] = 50;
+		table[72][(int)NodeType::TermOp] = 49;
+		table[72][(int)NodeType::ConditionalOp] = 48;
+		table[72][(int)NodeType::LogicalOp] = 47;
+		table[73][(int)NodeType::FactorOp] = 50;
+		table[73][(int)NodeType::TermOp] = 49;
+		table[73][(int)NodeType::ConditionalOp] = 48;
+		table[73][(int)NodeType::LogicalOp] = 47;
+		table[74][(int)NodeType::FactorOp] = 50;
+		table[74][(int)NodeType::TermOp] = 49;
+		table[74][(int)NodeType::ConditionalOp] = 48;
+		table[74][(int)NodeType::LogicalOp] = 47;
+		table[75][(int)NodeType::FactorOp] = 50;
+		table[75][(int)NodeType::TermOp] = 49;
+		table[75][(int)NodeType::ConditionalOp] = 48;
+		table[75][(int)NodeType::LogicalOp] = 47;
+		table[76][(int)NodeType::FactorOp] = 50;
+		table[76][(int)NodeType::TermOp] = 49;
+		table[76][(int)NodeType::ConditionalOp] = 48;
+		table[76][(int)NodeType::LogicalOp] = 47;
+		table[77][(int)NodeType::FactorOp] = 50;
+		table[77][(int)NodeType::TermOp] = 49;
+		table[77][(int)NodeType::ConditionalOp] = 48;
+		table[77][(int)NodeType::LogicalOp] = 47;
+		table[79][(int)NodeType::ArgRecurse] = 88;
+		table[79][(int)NodeType::FactorOp] = 50;
+		table[79][(int)NodeType::TermOp] = 49;
+		table[79][(int)NodeType::ConditionalOp] = 48;
+		table[79][(int)NodeType::LogicalOp] = 47;
+		table[80][(int)NodeType::FactorOp] = 50;
+		table[80][(int)NodeType::TermOp] = 49;
+		table[80][(int)NodeType::ConditionalOp] = 48;
+		table[80][(int)NodeType::LogicalOp] = 47;
+		table[83][(int)NodeType::ParamRecurse] = 91;
+		table[84][(int)NodeType::UnaryOp] = 36;
+		table[84][(int)NodeType::Grouping] = 29;
+		table[84][(int)NodeType::Call] = 27;
+		table[84][(int)NodeType::Primary] = 28;
+		table[84][(int)NodeType::Unary] = 26;
+		table[84][(int)NodeType::Literal] = 30;
+		table[84][(int)NodeType::Factor] = 25;
+		table[84][(int)NodeType::Term] = 24;
+		table[84][(int)NodeType::Block] = 93;
+		table[84][(int)NodeType::Statement] = 5;
+		table[84][(int)NodeType::Expression] = 16;
+		table[84][(int)NodeType::IfStatement] = 6;
+		table[84][(int)NodeType::VarDeclareStatement] = 17;
+		table[84][(int)NodeType::Conditional] = 23;
+		table[84][(int)NodeType::ElseStatement] = 8;
+		table[84][(int)NodeType::WhileStatement] = 9;
+		table[84][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[84][(int)NodeType::ReturnStatement] = 18;
+		table[84][(int)NodeType::ElseIfStatement] = 7;
+		table[84][(int)NodeType::Logical] = 22;
+		table[84][(int)NodeType::Identifier] = 20;
+		table[85][(int)NodeType::UnaryOp] = 36;
+		table[85][(int)NodeType::Grouping] = 29;
+		table[85][(int)NodeType::Call] = 27;
+		table[85][(int)NodeType::Primary] = 28;
+		table[85][(int)NodeType::Unary] = 26;
+		table[85][(int)NodeType::Literal] = 30;
+		table[85][(int)NodeType::Factor] = 25;
+		table[85][(int)NodeType::Term] = 24;
+		table[85][(int)NodeType::Block] = 94;
+		table[85][(int)NodeType::Statement] = 5;
+		table[85][(int)NodeType::Expression] = 16;
+		table[85][(int)NodeType::IfStatement] = 6;
+		table[85][(int)NodeType::VarDeclareStatement] = 17;
+		table[85][(int)NodeType::Conditional] = 23;
+		table[85][(int)NodeType::ElseStatement] = 8;
+		table[85][(int)NodeType::WhileStatement] = 9;
+		table[85][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[85][(int)NodeType::ReturnStatement] = 18;
+		table[85][(int)NodeType::ElseIfStatement] = 7;
+		table[85][(int)NodeType::Logical] = 22;
+		table[85][(int)NodeType::Identifier] = 20;
+		table[86][(int)NodeType::UnaryOp] = 36;
+		table[86][(int)NodeType::Grouping] = 29;
+		table[86][(int)NodeType::Call] = 27;
+		table[86][(int)NodeType::Primary] = 28;
+		table[86][(int)NodeType::Unary] = 26;
+		table[86][(int)NodeType::Literal] = 30;
+		table[86][(int)NodeType::Factor] = 25;
+		table[86][(int)NodeType::Term] = 24;
+		table[86][(int)NodeType::Block] = 95;
+		table[86][(int)NodeType::Statement] = 5;
+		table[86][(int)NodeType::Expression] = 16;
+		table[86][(int)NodeType::IfStatement] = 6;
+		table[86][(int)NodeType::VarDeclareStatement] = 17;
+		table[86][(int)NodeType::Conditional] = 23;
+		table[86][(int)NodeType::ElseStatement] = 8;
+		table[86][(int)NodeType::WhileStatement] = 9;
+		table[86][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[86][(int)NodeType::ReturnStatement] = 18;
+		table[86][(int)NodeType::ElseIfStatement] = 7;
+		table[86][(int)NodeType::Logical] = 22;
+		table[86][(int)NodeType::Identifier] = 20;
+		table[89][(int)NodeType::UnaryOp] = 36;
+		table[89][(int)NodeType::Literal] = 30;
+		table[89][(int)NodeType::Primary] = 28;
+		table[89][(int)NodeType::Grouping] = 29;
+		table[89][(int)NodeType::Call] = 27;
+		table[89][(int)NodeType::Unary] = 26;
+		table[89][(int)NodeType::Factor] = 25;
+		table[89][(int)NodeType::Identifier] = 65;
+		table[89][(int)NodeType::Term] = 24;
+		table[89][(int)NodeType::Conditional] = 23;
+		table[89][(int)NodeType::Logical] = 22;
+		table[89][(int)NodeType::Expression] = 96;
+		table[90][(int)NodeType::UnaryOp] = 36;
+		table[90][(int)NodeType::Grouping] = 29;
+		table[90][(int)NodeType::Call] = 27;
+		table[90][(int)NodeType::Primary] = 28;
+		table[90][(int)NodeType::Unary] = 26;
+		table[90][(int)NodeType::Literal] = 30;
+		table[90][(int)NodeType::Factor] = 25;
+		table[90][(int)NodeType::Term] = 24;
+		table[90][(int)NodeType::Block] = 97;
+		table[90][(int)NodeType::Statement] = 5;
+		table[90][(int)NodeType::Expression] = 16;
+		table[90][(int)NodeType::IfStatement] = 6;
+		table[90][(int)NodeType::VarDeclareStatement] = 17;
+		table[90][(int)NodeType::Conditional] = 23;
+		table[90][(int)NodeType::ElseStatement] = 8;
+		table[90][(int)NodeType::WhileStatement] = 9;
+		table[90][(int)NodeType::FunctionDeclareStatement] = 10;
+		table[90][(int)NodeType::ReturnStatement] = 18;
+		table[90][(int)NodeType::ElseIfStatement] = 7;
+		table[90][(int)NodeType::Logical] = 22;
+		table[90][(int)NodeType::Identifier] = 20;
+		table[92][(int)NodeType::Identifier] = 98;
+		table[96][(int)NodeType::ArgRecurse] = 99;
+		table[96][(int)NodeType::FactorOp] = 50;
+		table[96][(int)NodeType::TermOp] = 49;
+		table[96][(int)NodeType::ConditionalOp] = 48;
+		table[96][(int)NodeType::LogicalOp] = 47;
+		table[98][(int)NodeType::ParamRecurse] = 100;
+		return table;
+	}();
+
+	static_assert(sizeof(Action) == 2 * sizeof(int32_t), "Table files store actions as two words");
+	struct LoadedTables
+	{
+		SourceFile file;
+		uint32_t tokens = 0, nodes = 0;
+		const Action* defaultActions = nullptr;
+		const uint8_t* reducesOnly = nullptr;
+		const Action* actions = nullptr;
+		const int32_t* gotos = nullptr;
+		std::vector<Production> grammar;
+		// The file's column for each of this parser's types, -1 if it has none
+		std::array<int, TOKEN_NUM> tokenColumns;
+		std::array<int, NODE_NUM> nodeColumns;
+
+		inline const Action& action(int state, TokenType type) const
+		{
+			int column = tokenColumns[(int)type];
+			if (reducesOnly[state] || column == -1)
+				return defaultActions[state];
+			const Action& entry = actions[state * tokens + column];
+			return entry.type != ActionType::None ? entry : defaultActions[state];
+		}
+		inline int gotoState(int state, NodeType type) const
+		{
+			int column = nodeColumns[(int)type];
+			return column == -1 ? 0 : gotos[state * nodes + column];
+		}
+	};
+	std::unique_ptr<LoadedTables> m_tables;
+
+	static bool tablesError(const char* path, const std::string& reason)
+	{
+		std::cout << path << " " << reason << std::endl;
+		return false;
+	}
+
+	// Loaded tables whose entries are in range can still pop more than was pushed or never stop reducing
+	[[noreturn]] static void corruptTables()
+	{
+		std::cout << "The loaded parse tables are corrupt" << std::endl;
+		exit(-2);
+	}
+
+	static constexpr std::pair<const char*, TokenType> s_tokenNames[] = {
+		{ "AndAnd", TokenType::AndAnd }, { "Asterisk", TokenType::Asterisk }, { "Bang", TokenType::Bang }, { "Bool", TokenType::Bool },
+		{ "Comma", TokenType::Comma }, { "Else", TokenType::Else }, { "ElseIf", TokenType::ElseIf }, { "Equal", TokenType::Equal },
+		{ "EqualEqual", TokenType::EqualEqual }, { "Float", TokenType::Float }, { "Func", TokenType::Func }, { "GreaterThan", TokenType::GreaterThan },
+		{ "GreaterThanEqual", TokenType::GreaterThanEqual }, { "Identifier", TokenType::Identifier }, { "If", TokenType::If }, { "Integer", TokenType::Integer },
+		{ "LeftCurly", TokenType::LeftCurly }, { "LeftParen", TokenType::LeftParen }, { "LessThan", TokenType::LessThan }, { "LessThanEqual", TokenType::LessThanEqual },
+		{ "Minus", TokenType::Minus }, { "NotEqual", TokenType::NotEqual }, { "OrOr", TokenType::OrOr }, { "Plus", TokenType::Plus },
+		{ "Return", TokenType::Return }, { "RightCurly", TokenType::RightCurly }, { "RightParen", TokenType::RightParen }, { "Semicolon", TokenType::Semicolon },
+		{ "Slash", TokenType::Slash }, { "String", TokenType::String }, { "While", TokenType::While }, { "_EOF", TokenType::_EOF },
+	};
+	static constexpr const char* s_nodeNames[NODE_NUM] = {
+		"ElseStatement", "Expression", "ElseIfStatement", "Logical", "VarDeclareStatement", "Conditional",
+		"ParamRecurse", "ReturnStatement", "FactorOp", "Statement", "Block", "FunctionDeclareStatement",
+		"LogicalOp", "Statements", "File", "ConditionalOp", "Unary", "Parameters",
+		"Primary", "Term", "IfStatement", "Factor", "WhileStatement", "TermOp",
+		"UnaryOp", "Identifier", "Call", "Arguments", "Grouping", "Literal",
+		"ArgRecurse",
+	};
+
+	// Loaded tables have no code, they are walked like the other layouts do
+	template<typename TokenReader, typename OnShift, typename OnReduce>
+	void driveTables(TokenReader& tokens, OnShift onShift, OnReduce onReduce)
 	{
-		std::queue<Token, std::deque<Token>> input(std::deque<Token>(tokens.begin(), tokens.end()));
 		std::stack<int> stack;
 		stack.push(0);
-		std::stack<Node> output;
-		Token beforeToken = input.front();
 		int state = 0;
+		// A correct parser only reduces so many times between two shifts, loaded
+		// tables that reduce in a loop are stopped before the stack grows without end
+		const size_t rules = m_tables ? m_tables->grammar.size() : GRAMMAR_NUM;
+		size_t reductions = 0, shiftedDepth = 1;
 		while (true)
 		{
 			state = stack.top();
-			Token& current = input.front();
-			Action& nextAction = m_actionTable[state][current.type];
+			const Action& nextAction = action(state, tokens.type());
 			if (nextAction.type == ActionType::None)
 			{
-				if (current.type == TokenType::_EOF)
-					std::cout << "Unexpected end of file at line " << current.line << " at pos " << current.pos << std::endl;
+				LineIndex::Location at = LineIndex::script().locate(tokens.token().offset);
+				if (tokens.type() == TokenType::_EOF)
+					std::cout << "Unexpected end of file at line " << at.line << " at pos " << at.pos << std::endl;
 				else
-					std::cout << "Error parsing line " << current.line << " at pos " << current.pos << std::endl;
+					std::cout << "Error parsing line " << at.line << " at pos " << at.pos << std::endl;
 				exit(-2);
 			}
 			else if (nextAction.type == ActionType::Shift)
 			{
-				beforeToken = input.front();
-				input.pop();
+				onShift(tokens.token());
+				tokens.advance();
 				stack.push(nextAction.value);
+				reductions = 0;
+				shiftedDepth = stack.size();
 			}
 			else if (nextAction.type == ActionType::Reduce)
 			{
 				// Push the rule to the stack
-				Production production = m_grammar[nextAction.value - 1];
-				for (int i = 0; i < production.rhs; i++)
+				const Production& rule = production(nextAction.value);
+				if (rule.rhs >= (int)stack.size() || ++reductions > (shiftedDepth + 1) * rules)
+					corruptTables();
+				for (int i = 0; i < rule.rhs; i++)
 					stack.pop();
-				stack.push(m_gotoTable[stack.top()][production.lhs]);
-				Node node;
-				node.terminal = production.terminates;
-				node.type = production.lhs;
-				if (production.terminates)
-					node.token = beforeToken;
-				else
-				{
-					for (int i = 0; i < production.rhsNodes; i++)
-					{
-						node.children.push_back(output.top());
-						output.pop();
-					}
-				}
-				output.push(node);
+				stack.push(gotoState(stack.top(), rule.lhs));
+				onReduce(rule, nextAction.value);
 			}
 			else if (nextAction.type == ActionType::Accept)
 			{
 				break;
 			}
 		}
-		Node root = output.top();
-		std::stack<Node*> toReverse({ &root });
-		while (!toReverse.empty())
+	}
+
+	template<typename TokenReader, typename OnShift, typename OnReduce>
+	void drive(TokenReader& tokens, OnShift onShift, OnReduce onReduce)
+	{
+		if (m_tables)
+		{
+			driveTables(tokens, onShift, onReduce);
+			return;
+		}
+		std::vector<int> stack;
+		stack.reserve(64);
+		goto state0;
+	state0:
+		stack.push_back(0);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state1:
+		stack.push_back(1);
+		switch (tokens.type())
+		{
+		case TokenType::_EOF: return;
+		default: goto error;
+		}
+	state2:
+		stack.push_back(2);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto reduce1;
+		}
+	state3:
+		stack.push_back(3);
+		goto reduce3;
+	state4:
+		stack.push_back(4);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state5:
+		stack.push_back(5);
+		switch (tokens.type())
+		{
+		case TokenType::Semicolon: onShift(tokens.token()); tokens.advance(); goto state41;
+		default: goto error;
+		}
+	state6:
+		stack.push_back(6);
+		goto reduce6;
+	state7:
+		stack.push_back(7);
+		goto reduce7;
+	state8:
+		stack.push_back(8);
+		goto reduce8;
+	state9:
+		stack.push_back(9);
+		goto reduce9;
+	state10:
+		stack.push_back(10);
+		goto reduce10;
+	state11:
+		stack.push_back(11);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		default: goto error;
+		}
+	state12:
+		stack.push_back(12);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state43;
+		default: goto error;
+		}
+	state13:
+		stack.push_back(13);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state14:
+		stack.push_back(14);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state45;
+		default: goto error;
+		}
+	state15:
+		stack.push_back(15);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state46;
+		default: goto error;
+		}
+	state16:
+		stack.push_back(16);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto reduce11;
+		}
+	state17:
+		stack.push_back(17);
+		goto reduce12;
+	state18:
+		stack.push_back(18);
+		goto reduce13;
+	state19:
+		stack.push_back(19);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto reduce19;
+		}
+	state20:
+		stack.push_back(20);
+		switch (tokens.type())
+		{
+		case TokenType::Equal: onShift(tokens.token()); tokens.advance(); goto state66;
+		default: goto reduce57;
+		}
+	state21:
+		stack.push_back(21);
+		goto reduce64;
+	state22:
+		stack.push_back(22);
+		goto reduce26;
+	state23:
+		stack.push_back(23);
+		goto reduce27;
+	state24:
+		stack.push_back(24);
+		goto reduce28;
+	state25:
+		stack.push_back(25);
+		goto reduce29;
+	state26:
+		stack.push_back(26);
+		goto reduce30;
+	state27:
+		stack.push_back(27);
+		goto reduce31;
+	state28:
+		stack.push_back(28);
+		goto reduce32;
+	state29:
+		stack.push_back(29);
+		goto reduce58;
+	state30:
+		stack.push_back(30);
+		goto reduce59;
+	state31:
+		stack.push_back(31);
+		goto reduce61;
+	state32:
+		stack.push_back(32);
+		goto reduce62;
+	state33:
+		stack.push_back(33);
+		goto reduce63;
+	state34:
+		stack.push_back(34);
+		goto reduce65;
+	state35:
+		stack.push_back(35);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state36:
+		stack.push_back(36);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state37:
+		stack.push_back(37);
+		goto reduce50;
+	state38:
+		stack.push_back(38);
+		goto reduce51;
+	state39:
+		stack.push_back(39);
+		goto reduce2;
+	state40:
+		stack.push_back(40);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		case TokenType::RightCurly: onShift(tokens.token()); tokens.advance(); goto state69;
+		default: goto error;
+		}
+	state41:
+		stack.push_back(41);
+		goto reduce5;
+	state42:
+		stack.push_back(42);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state70;
+		default: goto error;
+		}
+	state43:
+		stack.push_back(43);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state44:
+		stack.push_back(44);
+		goto reduce25;
+	state45:
+		stack.push_back(45);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state46:
+		stack.push_back(46);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state47:
+		stack.push_back(47);
+		switch (tokens.type())
 		{
-			Node* node = toReverse.top();
-			toReverse.pop();
-			for (Node& child : node->children)
-				toReverse.push(&child);
-			std::reverse(node->children.begin(), node->children.end());
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state48:
+		stack.push_back(48);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state49:
+		stack.push_back(49);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state50:
+		stack.push_back(50);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state51:
+		stack.push_back(51);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto reduce53;
+		}
+	state52:
+		stack.push_back(52);
+		goto reduce34;
+	state53:
+		stack.push_back(53);
+		goto reduce35;
+	state54:
+		stack.push_back(54);
+		goto reduce37;
+	state55:
+		stack.push_back(55);
+		goto reduce38;
+	state56:
+		stack.push_back(56);
+		goto reduce39;
+	state57:
+		stack.push_back(57);
+		goto reduce40;
+	state58:
+		stack.push_back(58);
+		goto reduce41;
+	state59:
+		stack.push_back(59);
+		goto reduce42;
+	state60:
+		stack.push_back(60);
+		goto reduce44;
+	state61:
+		stack.push_back(61);
+		goto reduce45;
+	state62:
+		stack.push_back(62);
+		goto reduce47;
+	state63:
+		stack.push_back(63);
+		goto reduce48;
+	state64:
+		stack.push_back(64);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto reduce20;
+		}
+	state65:
+		stack.push_back(65);
+		goto reduce57;
+	state66:
+		stack.push_back(66);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state67:
+		stack.push_back(67);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state81;
+		default: goto error;
+		}
+	state68:
+		stack.push_back(68);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		default: goto reduce49;
+		}
+	state69:
+		stack.push_back(69);
+		goto reduce4;
+	state70:
+		stack.push_back(70);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		default: goto reduce15;
+		}
+	state71:
+		stack.push_back(71);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state84;
+		default: goto error;
+		}
+	state72:
+		stack.push_back(72);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state85;
+		default: goto error;
+		}
+	state73:
+		stack.push_back(73);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state86;
+		default: goto error;
+		}
+	state74:
+		stack.push_back(74);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto reduce33;
+		}
+	state75:
+		stack.push_back(75);
+		switch (tokens.type())
+		{
+		case TokenType::AndAnd: case TokenType::Comma: case TokenType::OrOr: case TokenType::RightParen: case TokenType::Semicolon: goto reduce36;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto error;
+		}
+	state76:
+		stack.push_back(76);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto reduce43;
+		}
+	state77:
+		stack.push_back(77);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		default: goto reduce46;
+		}
+	state78:
+		stack.push_back(78);
+		switch (tokens.type())
+		{
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state87;
+		default: goto error;
+		}
+	state79:
+		stack.push_back(79);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::Comma: onShift(tokens.token()); tokens.advance(); goto state89;
+		default: goto reduce55;
+		}
+	state80:
+		stack.push_back(80);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		default: goto reduce21;
+		}
+	state81:
+		stack.push_back(81);
+		goto reduce60;
+	state82:
+		stack.push_back(82);
+		switch (tokens.type())
+		{
+		case TokenType::RightParen: onShift(tokens.token()); tokens.advance(); goto state90;
+		default: goto error;
+		}
+	state83:
+		stack.push_back(83);
+		switch (tokens.type())
+		{
+		case TokenType::Comma: onShift(tokens.token()); tokens.advance(); goto state92;
+		default: goto reduce17;
+		}
+	state84:
+		stack.push_back(84);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state85:
+		stack.push_back(85);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state86:
+		stack.push_back(86);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state87:
+		stack.push_back(87);
+		goto reduce52;
+	state88:
+		stack.push_back(88);
+		goto reduce54;
+	state89:
+		stack.push_back(89);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state90:
+		stack.push_back(90);
+		switch (tokens.type())
+		{
+		case TokenType::LeftCurly: onShift(tokens.token()); tokens.advance(); goto state4;
+		case TokenType::Func: onShift(tokens.token()); tokens.advance(); goto state11;
+		case TokenType::While: onShift(tokens.token()); tokens.advance(); goto state12;
+		case TokenType::Else: onShift(tokens.token()); tokens.advance(); goto state13;
+		case TokenType::ElseIf: onShift(tokens.token()); tokens.advance(); goto state14;
+		case TokenType::If: onShift(tokens.token()); tokens.advance(); goto state15;
+		case TokenType::Return: onShift(tokens.token()); tokens.advance(); goto state19;
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		case TokenType::Integer: onShift(tokens.token()); tokens.advance(); goto state31;
+		case TokenType::Float: onShift(tokens.token()); tokens.advance(); goto state32;
+		case TokenType::String: onShift(tokens.token()); tokens.advance(); goto state33;
+		case TokenType::Bool: onShift(tokens.token()); tokens.advance(); goto state34;
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state35;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state37;
+		case TokenType::Bang: onShift(tokens.token()); tokens.advance(); goto state38;
+		default: goto error;
+		}
+	state91:
+		stack.push_back(91);
+		goto reduce16;
+	state92:
+		stack.push_back(92);
+		switch (tokens.type())
+		{
+		case TokenType::Identifier: onShift(tokens.token()); tokens.advance(); goto state21;
+		default: goto error;
+		}
+	state93:
+		stack.push_back(93);
+		goto reduce22;
+	state94:
+		stack.push_back(94);
+		goto reduce24;
+	state95:
+		stack.push_back(95);
+		goto reduce23;
+	state96:
+		stack.push_back(96);
+		switch (tokens.type())
+		{
+		case TokenType::LeftParen: onShift(tokens.token()); tokens.advance(); goto state51;
+		case TokenType::AndAnd: onShift(tokens.token()); tokens.advance(); goto state52;
+		case TokenType::OrOr: onShift(tokens.token()); tokens.advance(); goto state53;
+		case TokenType::EqualEqual: onShift(tokens.token()); tokens.advance(); goto state54;
+		case TokenType::NotEqual: onShift(tokens.token()); tokens.advance(); goto state55;
+		case TokenType::GreaterThan: onShift(tokens.token()); tokens.advance(); goto state56;
+		case TokenType::GreaterThanEqual: onShift(tokens.token()); tokens.advance(); goto state57;
+		case TokenType::LessThan: onShift(tokens.token()); tokens.advance(); goto state58;
+		case TokenType::LessThanEqual: onShift(tokens.token()); tokens.advance(); goto state59;
+		case TokenType::Plus: onShift(tokens.token()); tokens.advance(); goto state60;
+		case TokenType::Minus: onShift(tokens.token()); tokens.advance(); goto state61;
+		case TokenType::Asterisk: onShift(tokens.token()); tokens.advance(); goto state62;
+		case TokenType::Slash: onShift(tokens.token()); tokens.advance(); goto state63;
+		case TokenType::Comma: onShift(tokens.token()); tokens.advance(); goto state89;
+		default: goto reduce55;
+		}
+	state97:
+		stack.push_back(97);
+		goto reduce14;
+	state98:
+		stack.push_back(98);
+		switch (tokens.type())
+		{
+		case TokenType::Comma: onShift(tokens.token()); tokens.advance(); goto state92;
+		default: goto reduce17;
+		}
+	state99:
+		stack.push_back(99);
+		goto reduce56;
+	state100:
+		stack.push_back(100);
+		goto reduce18;
+	reduce1:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[0], 1);
+		goto gotoFile;
+	reduce2:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[1], 2);
+		goto gotoStatements;
+	reduce3:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[2], 3);
+		goto gotoStatements;
+	reduce4:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[3], 4);
+		goto gotoBlock;
+	reduce5:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[4], 5);
+		goto gotoBlock;
+	reduce6:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[5], 6);
+		goto gotoBlock;
+	reduce7:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[6], 7);
+		goto gotoBlock;
+	reduce8:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[7], 8);
+		goto gotoBlock;
+	reduce9:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[8], 9);
+		goto gotoBlock;
+	reduce10:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[9], 10);
+		goto gotoBlock;
+	reduce11:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[10], 11);
+		goto gotoStatement;
+	reduce12:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[11], 12);
+		goto gotoStatement;
+	reduce13:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[12], 13);
+		goto gotoStatement;
+	reduce14:
+		stack.resize(stack.size() - 6);
+		onReduce(s_grammar[13], 14);
+		goto gotoFunctionDeclareStatement;
+	reduce15:
+		stack.resize(stack.size() - 0);
+		onReduce(s_grammar[14], 15);
+		goto gotoParameters;
+	reduce16:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[15], 16);
+		goto gotoParameters;
+	reduce17:
+		stack.resize(stack.size() - 0);
+		onReduce(s_grammar[16], 17);
+		goto gotoParamRecurse;
+	reduce18:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[17], 18);
+		goto gotoParamRecurse;
+	reduce19:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[18], 19);
+		goto gotoReturnStatement;
+	reduce20:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[19], 20);
+		goto gotoReturnStatement;
+	reduce21:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[20], 21);
+		goto gotoVarDeclareStatement;
+	reduce22:
+		stack.resize(stack.size() - 5);
+		onReduce(s_grammar[21], 22);
+		goto gotoWhileStatement;
+	reduce23:
+		stack.resize(stack.size() - 5);
+		onReduce(s_grammar[22], 23);
+		goto gotoIfStatement;
+	reduce24:
+		stack.resize(stack.size() - 5);
+		onReduce(s_grammar[23], 24);
+		goto gotoElseIfStatement;
+	reduce25:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[24], 25);
+		goto gotoElseStatement;
+	reduce26:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[25], 26);
+		goto gotoExpression;
+	reduce27:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[26], 27);
+		goto gotoExpression;
+	reduce28:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[27], 28);
+		goto gotoExpression;
+	reduce29:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[28], 29);
+		goto gotoExpression;
+	reduce30:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[29], 30);
+		goto gotoExpression;
+	reduce31:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[30], 31);
+		goto gotoExpression;
+	reduce32:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[31], 32);
+		goto gotoExpression;
+	reduce33:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[32], 33);
+		goto gotoLogical;
+	reduce34:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[33], 34);
+		goto gotoLogicalOp;
+	reduce35:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[34], 35);
+		goto gotoLogicalOp;
+	reduce36:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[35], 36);
+		goto gotoConditional;
+	reduce37:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[36], 37);
+		goto gotoConditionalOp;
+	reduce38:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[37], 38);
+		goto gotoConditionalOp;
+	reduce39:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[38], 39);
+		goto gotoConditionalOp;
+	reduce40:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[39], 40);
+		goto gotoConditionalOp;
+	reduce41:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[40], 41);
+		goto gotoConditionalOp;
+	reduce42:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[41], 42);
+		goto gotoConditionalOp;
+	reduce43:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[42], 43);
+		goto gotoTerm;
+	reduce44:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[43], 44);
+		goto gotoTermOp;
+	reduce45:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[44], 45);
+		goto gotoTermOp;
+	reduce46:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[45], 46);
+		goto gotoFactor;
+	reduce47:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[46], 47);
+		goto gotoFactorOp;
+	reduce48:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[47], 48);
+		goto gotoFactorOp;
+	reduce49:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[48], 49);
+		goto gotoUnary;
+	reduce50:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[49], 50);
+		goto gotoUnaryOp;
+	reduce51:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[50], 51);
+		goto gotoUnaryOp;
+	reduce52:
+		stack.resize(stack.size() - 4);
+		onReduce(s_grammar[51], 52);
+		goto gotoCall;
+	reduce53:
+		stack.resize(stack.size() - 0);
+		onReduce(s_grammar[52], 53);
+		goto gotoArguments;
+	reduce54:
+		stack.resize(stack.size() - 2);
+		onReduce(s_grammar[53], 54);
+		goto gotoArguments;
+	reduce55:
+		stack.resize(stack.size() - 0);
+		onReduce(s_grammar[54], 55);
+		goto gotoArgRecurse;
+	reduce56:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[55], 56);
+		goto gotoArgRecurse;
+	reduce57:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[56], 57);
+		goto gotoPrimary;
+	reduce58:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[57], 58);
+		goto gotoPrimary;
+	reduce59:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[58], 59);
+		goto gotoPrimary;
+	reduce60:
+		stack.resize(stack.size() - 3);
+		onReduce(s_grammar[59], 60);
+		goto gotoGrouping;
+	reduce61:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[60], 61);
+		goto gotoLiteral;
+	reduce62:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[61], 62);
+		goto gotoLiteral;
+	reduce63:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[62], 63);
+		goto gotoLiteral;
+	reduce64:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[63], 64);
+		goto gotoIdentifier;
+	reduce65:
+		stack.resize(stack.size() - 1);
+		onReduce(s_grammar[64], 65);
+		goto gotoLiteral;
+	gotoArgRecurse:
+		switch (stack.back())
+		{
+		case 96: goto state99;
+		default: goto state88;
+		}
+	gotoArguments:
+		switch (stack.back())
+		{
+		default: goto state78;
+		}
+	gotoBlock:
+		switch (stack.back())
+		{
+		case 2: case 40: goto state39;
+		case 13: goto state44;
+		case 84: goto state93;
+		case 85: goto state94;
+		case 86: goto state95;
+		case 90: goto state97;
+		default: goto state3;
+		}
+	gotoCall:
+		switch (stack.back())
+		{
+		default: goto state27;
+		}
+	gotoConditional:
+		switch (stack.back())
+		{
+		default: goto state23;
+		}
+	gotoConditionalOp:
+		switch (stack.back())
+		{
+		default: goto state48;
+		}
+	gotoElseIfStatement:
+		switch (stack.back())
+		{
+		default: goto state7;
+		}
+	gotoElseStatement:
+		switch (stack.back())
+		{
+		default: goto state8;
+		}
+	gotoExpression:
+		switch (stack.back())
+		{
+		case 19: goto state64;
+		case 35: goto state67;
+		case 36: goto state68;
+		case 43: goto state71;
+		case 45: goto state72;
+		case 46: goto state73;
+		case 47: goto state74;
+		case 48: goto state75;
+		case 49: goto state76;
+		case 50: goto state77;
+		case 51: goto state79;
+		case 66: goto state80;
+		case 89: goto state96;
+		default: goto state16;
+		}
+	gotoFactor:
+		switch (stack.back())
+		{
+		default: goto state25;
+		}
+	gotoFactorOp:
+		switch (stack.back())
+		{
+		default: goto state50;
+		}
+	gotoFile:
+		switch (stack.back())
+		{
+		default: goto state1;
+		}
+	gotoFunctionDeclareStatement:
+		switch (stack.back())
+		{
+		default: goto state10;
+		}
+	gotoGrouping:
+		switch (stack.back())
+		{
+		default: goto state29;
+		}
+	gotoIdentifier:
+		switch (stack.back())
+		{
+		case 0: case 2: case 4: case 13: case 40: case 84: case 85: case 86: case 90: goto state20;
+		case 11: goto state42;
+		case 70: goto state83;
+		case 92: goto state98;
+		default: goto state65;
+		}
+	gotoIfStatement:
+		switch (stack.back())
+		{
+		default: goto state6;
+		}
+	gotoLiteral:
+		switch (stack.back())
+		{
+		default: goto state30;
+		}
+	gotoLogical:
+		switch (stack.back())
+		{
+		default: goto state22;
+		}
+	gotoLogicalOp:
+		switch (stack.back())
+		{
+		default: goto state47;
+		}
+	gotoParamRecurse:
+		switch (stack.back())
+		{
+		case 98: goto state100;
+		default: goto state91;
+		}
+	gotoParameters:
+		switch (stack.back())
+		{
+		default: goto state82;
+		}
+	gotoPrimary:
+		switch (stack.back())
+		{
+		default: goto state28;
+		}
+	gotoReturnStatement:
+		switch (stack.back())
+		{
+		default: goto state18;
+		}
+	gotoStatement:
+		switch (stack.back())
+		{
+		default: goto state5;
+		}
+	gotoStatements:
+		switch (stack.back())
+		{
+		case 4: goto state40;
+		default: goto state2;
+		}
+	gotoTerm:
+		switch (stack.back())
+		{
+		default: goto state24;
+		}
+	gotoTermOp:
+		switch (stack.back())
+		{
+		default: goto state49;
+		}
+	gotoUnary:
+		switch (stack.back())
+		{
+		default: goto state26;
+		}
+	gotoUnaryOp:
+		switch (stack.back())
+		{
+		default: goto state36;
+		}
+	gotoVarDeclareStatement:
+		switch (stack.back())
+		{
+		default: goto state17;
+		}
+	gotoWhileStatement:
+		switch (stack.back())
+		{
+		default: goto state9;
+		}
+	error:
+		{
+			LineIndex::Location at = LineIndex::script().locate(tokens.token().offset);
+			if (tokens.type() == TokenType::_EOF)
+				std::cout << "Unexpected end of file at line " << at.line << " at pos " << at.pos << std::endl;
+			else
+				std::cout << "Error parsing line " << at.line << " at pos " << at.pos << std::endl;
+			exit(-2);
+		}
+	}
+
+public:
+	// The automaton both parse and build drive, they only differ in what they keep
+	template<typename TokenStream, typename OnShift, typename OnReduce>
+	void run(TokenStream& tokens, OnShift onShift, OnReduce onReduce)
+	{
+		if constexpr (requires { tokens.type(); })
+			drive(tokens, onShift, onReduce);
+		else
+		{
+			PulledTokens<TokenStream> pulled(tokens);
+			drive(pulled, onShift, onReduce);
 		}
-		return root;
 	}
+
 private:
-	Production m_grammar[GRAMMAR_NUM];
-	std::unordered_map<TokenType, Action> m_actionTable[SET_NUM];
-	std::unordered_map<NodeType, int> m_gotoTable[SET_NUM];
+	static SemanticValue reduceAction(int rule, SemanticValue* rhs)
+	{
+		switch (rule)
+		{
+		case 2: return appendBlock(rhs[0], rhs[1]);
+		case 3: return buildStatements(rhs[0]);
+		case 4: return buildBlock(rhs[1]);
+		case 5: return std::move(rhs[0]);
+		case 11: return buildExpressionStatement(rhs[0]);
+		case 14: return buildFuncDeclare(rhs[1], rhs[3], rhs[5]);
+		case 15: return buildParams();
+		case 16: return buildParams(rhs[0], rhs[1]);
+		case 17: return buildParams();
+		case 18: return buildParams(rhs[1], rhs[2]);
+		case 19: return buildReturn();
+		case 20: return buildReturn(rhs[1]);
+		case 21: return buildVarDeclare(rhs[0], rhs[2]);
+		case 22: return buildWhile(rhs[2], rhs[4]);
+		case 23: return buildIf(rhs[2], rhs[4], StatementType::If);
+		case 24: return buildIf(rhs[2], rhs[4], StatementType::ElseIf);
+		case 25: return buildElse(rhs[1]);
+		case 33: return buildLogical(rhs[0], rhs[1], rhs[2]);
+		case 34: return std::move(rhs[0]);
+		case 35: return std::move(rhs[0]);
+		case 36: return buildConditional(rhs[0], rhs[1], rhs[2]);
+		case 37: return std::move(rhs[0]);
+		case 38: return std::move(rhs[0]);
+		case 39: return std::move(rhs[0]);
+		case 40: return std::move(rhs[0]);
+		case 41: return std::move(rhs[0]);
+		case 42: return std::move(rhs[0]);
+		case 43: return buildBinary(rhs[0], rhs[1], rhs[2]);
+		case 44: return std::move(rhs[0]);
+		case 45: return std::move(rhs[0]);
+		case 46: return buildBinary(rhs[0], rhs[1], rhs[2]);
+		case 47: return std::move(rhs[0]);
+		case 48: return std::move(rhs[0]);
+		case 49: return buildUnary(rhs[0], rhs[1]);
+		case 50: return std::move(rhs[0]);
+		case 51: return std::move(rhs[0]);
+		case 52: return buildCall(rhs[0], rhs[2]);
+		case 53: return buildArgs();
+		case 54: return buildArgs(rhs[0], rhs[1]);
+		case 55: return buildArgs();
+		case 56: return buildArgs(rhs[1], rhs[2]);
+		case 57: return buildVar(rhs[0]);
+		case 60: return std::move(rhs[1]);
+		case 61: return buildLiteral(rhs[0]);
+		case 62: return buildLiteral(rhs[0]);
+		case 63: return buildLiteral(rhs[0]);
+		case 64: return std::move(rhs[0]);
+		case 65: return buildLiteral(rhs[0]);
+		}
+		return {};
+	}
 };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Token.h"
+
+#include <string_view>
+#include <utility>
+
+constexpr std::pair<std::string_view, TokenType> keywords[] = {
+	{"true", TokenType::Bool},
+	{"false", TokenType::Bool},
+
+	{"if", TokenType::If},
+	{"elif", TokenType::ElseIf},
+	{"else", TokenType::Else},
+	{"while", TokenType::While},
+	{"func", TokenType::Func},
+
+	{"return", TokenType::Return},
+	{"break", TokenType::Break},
+	{"continue", TokenType::Continue},
+};
+
+// Switches on the length and first character so an identifier is compared
+// against at most two keywords, returns Identifier when it is not one
+constexpr TokenType keywordType(std::string_view word)
+{
+	switch (word.size())
+	{
+	case 2:
+		if (word == "if") return TokenType::If;
+		break;
+	case 4:
+		switch (word[0])
+		{
+		case 't': if (word == "true") return TokenType::Bool; break;
+		case 'f': if (word == "func") return TokenType::Func; break;
+		case 'e':
+			if (word == "elif") return TokenType::ElseIf;
+			if (word == "else") return TokenType::Else;
+			break;
+		}
+		break;
+	case 5:
+		switch (word[0])
+		{
+		case 'f': if (word == "false") return TokenType::Bool; break;
+		case 'w': if (word == "while") return TokenType::While; break;
+		case 'b': if (word == "break") return TokenType::Break; break;
+		}
+		break;
+	case 6:
+		if (word == "return") return TokenType::Return;
+		break;
+	case 8:
+		if (word == "continue") return TokenType::Continue;
+		break;
+	}
+	return TokenType::Identifier;
+}
+
+constexpr bool keywordTypeMatchesTable()
+{
+	for (const auto& keyword : keywords)
+		if (keywordType(keyword.first) != keyword.second)
+			return false;
+	return true;
+}
+static_assert(keywordTypeMatchesTable(), "keywordType is missing an entry of the keywords table");
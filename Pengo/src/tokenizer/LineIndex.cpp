@@ -0,0 +1,39 @@
+#include "LineIndex.h"
+#include "Scanner.h"
+
+#include <algorithm>
+
+LineIndex& LineIndex::script()
+{
+	static LineIndex index;
+	return index;
+}
+
+void LineIndex::reset(std::string_view source)
+{
+	m_source = source;
+	m_lineStarts.clear();
+}
+
+LineIndex::Location LineIndex::locate(size_t offset) const
+{
+	const std::vector<uint32_t>& starts = lineStarts();
+	size_t line = std::upper_bound(starts.begin(), starts.end(), (uint32_t)offset) - starts.begin();
+	return { (int)line, (int)(offset - starts[line - 1]) };
+}
+
+const std::vector<uint32_t>& LineIndex::lineStarts() const
+{
+	if (m_lineStarts.empty())
+	{
+		const Scanner& scan = scanner();
+		const char* begin = m_source.data();
+		const char* end = begin + m_source.size();
+		const char* lastNewline = nullptr;
+		m_lineStarts.reserve(scan.countNewlines(begin, end, lastNewline) + 1);
+		m_lineStarts.push_back(0);
+		for (const char* p = scan.find(begin, end, CharClass::Newline); p < end; p = scan.find(p + 1, end, CharClass::Newline))
+			m_lineStarts.push_back((uint32_t)(p + 1 - begin));
+	}
+	return m_lineStarts;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Offsets of every line start in a source so tokens only have to carry a byte
+// offset. The newlines are found with the Scanner on the first lookup, lines
+// and positions are then a binary search, which only error messages pay for.
+class LineIndex
+{
+public:
+	struct Location
+	{
+		int line;
+		int pos;
+	};
+
+	// The script being run, runtime and parse errors are reported against it
+	static LineIndex& script();
+
+	// The source is borrowed, it has to outlive the index
+	LineIndex(std::string_view source = {}) : m_source(source) { }
+
+	// Points the index at another source, its lines are found on the next lookup
+	void reset(std::string_view source);
+
+	// Lines count from 1, pos is the distance from the start of the line
+	Location locate(size_t offset) const;
+private:
+	std::string_view m_source;
+	mutable std::vector<uint32_t> m_lineStarts;
+
+	const std::vector<uint32_t>& lineStarts() const;
+};
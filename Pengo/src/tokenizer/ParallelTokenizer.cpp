@@ -0,0 +1,126 @@
+#include "ParallelTokenizer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// Below this a chunk is not worth a thread
+#define MIN_CHUNK_SIZE (256 * 1024)
+// More chunks than threads so one slow chunk does not hold up the rest
+#define CHUNKS_PER_THREAD 4
+
+// Runs job(0..jobs-1) on a pool of threads pulling indices off a shared counter
+template<typename Job>
+static void runJobs(int threads, size_t jobs, Job job)
+{
+	std::atomic<size_t> nextJob = 0;
+	auto worker = [&]() {
+		for (size_t index = nextJob++; index < jobs; index = nextJob++)
+			job(index);
+	};
+	std::vector<std::thread> pool;
+	for (int i = 1; i < std::min<int>(threads, (int)jobs); i++)
+		pool.emplace_back(worker);
+	worker();
+	for (std::thread& thread : pool)
+		thread.join();
+}
+
+ParallelTokenizer::ParallelTokenizer(std::string_view source, int threads, const Scanner& scan) :
+	m_tokens(source), m_cursor(m_tokens)
+{
+	threads = std::max(threads, 1);
+	size_t count = std::min<size_t>((size_t)threads * CHUNKS_PER_THREAD, source.size() / MIN_CHUNK_SIZE);
+	split(source, scan, std::max<size_t>(count, 1));
+
+	runJobs(threads, m_chunks.size(), [&](size_t index) {
+		Chunk& chunk = *m_chunks[index];
+		Tokenizer tokenizer(chunk.source, source, chunk.symbols, scan);
+		chunk.tokens = tokenizer.tokenize();
+	});
+
+	// Interning the distinct names of each chunk is the only serial part
+	std::vector<std::vector<Atom>> remaps;
+	std::vector<size_t> offsets;
+	std::vector<uint32_t> decodedBases;
+	size_t total = 0;
+	for (std::unique_ptr<Chunk>& chunk : m_chunks)
+	{
+		std::vector<Atom>& remap = remaps.emplace_back(chunk->symbols.size());
+		for (Atom local = 0; local < (Atom)remap.size(); local++)
+			remap[local] = SymbolTable::global().intern(chunk->symbols.name(local));
+		decodedBases.push_back(m_tokens.takeDecoded(chunk->tokens));
+		offsets.push_back(total);
+		// Only the _EOF of the last chunk is the real end
+		total += chunk->tokens.size() - (chunk != m_chunks.back() ? 1 : 0);
+	}
+
+	m_tokens.resize(total);
+	runJobs(threads, m_chunks.size(), [&](size_t index) {
+		Chunk& chunk = *m_chunks[index];
+		size_t count = (index + 1 < m_chunks.size() ? offsets[index + 1] : total) - offsets[index];
+		uint32_t sourceOffset = (uint32_t)(chunk.source.data() - source.data());
+		m_tokens.place(offsets[index], chunk.tokens, count, sourceOffset, remaps[index].data(), decodedBases[index]);
+		chunk.tokens = TokenBuffer();
+	});
+}
+
+void ParallelTokenizer::split(std::string_view source, const Scanner& scan, size_t count)
+{
+	// Walks the source only stopping at quotes and slashes to know where string
+	// literals and comments are, newlines in between are safe places to cut
+	const char* begin = source.data();
+	const char* end = begin + source.size();
+	const char* chunkStart = begin;
+	const char* p = begin;
+	for (size_t i = 1; i < count; i++)
+	{
+		const char* target = begin + source.size() * i / count;
+		if (target <= chunkStart)
+			continue;
+		const char* cut = nullptr;
+		while (cut == nullptr && p < end)
+		{
+			const char* special = scan.find(p, end, CharClass::CodeSpecial);
+			if (special > target)
+			{
+				const char* newline = scan.find(std::max(p, target), special, CharClass::Newline);
+				if (newline < special)
+				{
+					cut = newline + 1;
+					break;
+				}
+			}
+			if (special == end)
+			{
+				p = end;
+				break;
+			}
+			if (*special == '"')
+			{
+				// Tokenizer::tokenizeString ends a literal at the first quote that is
+				// not escaped
+				special = scan.find(special + 1, end, CharClass::StringSpecial);
+				while (special < end && *special != '"')
+				{
+					bool skip = *special == '\\' && special + 1 < end;
+					special = scan.find(special + (skip ? 2 : 1), end, CharClass::StringSpecial);
+				}
+				p = special < end ? special + 1 : end;
+			}
+			else if (special + 1 < end && special[1] == '/')
+				p = scan.find(special + 2, end, CharClass::Newline);
+			else
+				p = special + 1;
+		}
+		if (cut == nullptr)
+			break;
+
+		std::unique_ptr<Chunk>& chunk = m_chunks.emplace_back(std::make_unique<Chunk>());
+		chunk->source = std::string_view(chunkStart, cut - chunkStart);
+		chunkStart = cut;
+		p = cut;
+	}
+	std::unique_ptr<Chunk>& chunk = m_chunks.emplace_back(std::make_unique<Chunk>());
+	chunk->source = std::string_view(chunkStart, end - chunkStart);
+}
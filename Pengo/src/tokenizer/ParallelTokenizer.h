@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Tokenizer.h"
+#include "TokenBuffer.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Tokenizes a whole source up front on several threads. The source is cut into
+// chunks at newlines that are outside of string literals, each chunk gets its
+// own Tokenizer and the results are stitched back together in order. Offers the
+// same next()/peek() interface as the Tokenizer so the parser can pull from it.
+class ParallelTokenizer
+{
+public:
+	// The source is borrowed, it has to outlive the tokenizer and its tokens
+	ParallelTokenizer(std::string_view source, int threads, const Scanner& scan = scanner());
+
+	inline Token next() { return m_cursor.next(); }
+	inline const Token& peek() { return m_cursor.peek(); }
+
+	inline const TokenBuffer& tokens() const { return m_tokens; }
+	inline size_t chunkCount() const { return m_chunks.size(); }
+private:
+	struct Chunk
+	{
+		std::string_view source;
+		// Identifiers are interned per chunk and remapped to global atoms after
+		SymbolTable symbols;
+		TokenBuffer tokens;
+	};
+
+	TokenBuffer m_tokens;
+	TokenBuffer::Cursor m_cursor;
+	std::vector<std::unique_ptr<Chunk>> m_chunks;
+
+	void split(std::string_view source, const Scanner& scan, size_t count);
+};
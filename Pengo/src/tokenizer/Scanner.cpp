@@ -0,0 +1,419 @@
+#include "Scanner.h"
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SCANNER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#include <cpuid.h>
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+static bool inClass(unsigned char c, CharClass type)
+{
+	switch (type)
+	{
+	case CharClass::Whitespace: return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+	case CharClass::Identifier: return ('a' <= (c | 0x20) && (c | 0x20) <= 'z') || ('0' <= c && c <= '9') || c == '_' || c >= 0x80;
+	case CharClass::Digit: return '0' <= c && c <= '9';
+	case CharClass::Newline: return c == '\n';
+	case CharClass::StringSpecial: return c == '"' || c == '\\' || c == '\n';
+	case CharClass::CodeSpecial: return c == '"' || c == '/';
+	}
+	return false;
+}
+
+static const char* scalarSkip(const char* begin, const char* end, CharClass type)
+{
+	while (begin < end && inClass(*begin, type))
+		begin++;
+	return begin;
+}
+
+static const char* scalarFind(const char* begin, const char* end, CharClass type)
+{
+	while (begin < end && !inClass(*begin, type))
+		begin++;
+	return begin;
+}
+
+static size_t scalarCountNewlines(const char* begin, const char* end, const char*& lastNewline)
+{
+	size_t count = 0;
+	for (; begin < end; begin++)
+		if (*begin == '\n')
+		{
+			count++;
+			lastNewline = begin;
+		}
+	return count;
+}
+
+// End of the well formed UTF-8 character starting at the non-ASCII byte p, or
+// null for overlong forms, surrogates, code points past U+10FFFF and stray or
+// missing continuation bytes
+static const char* utf8Character(const char* p, const char* end)
+{
+	unsigned char lead = (unsigned char)*p;
+	int length;
+	unsigned char low = 0x80, high = 0xBF;
+	if (0xC2 <= lead && lead <= 0xDF)
+		length = 2;
+	else if (0xE0 <= lead && lead <= 0xEF)
+	{
+		length = 3;
+		if (lead == 0xE0)
+			low = 0xA0;
+		else if (lead == 0xED)
+			high = 0x9F;
+	}
+	else if (0xF0 <= lead && lead <= 0xF4)
+	{
+		length = 4;
+		if (lead == 0xF0)
+			low = 0x90;
+		else if (lead == 0xF4)
+			high = 0x8F;
+	}
+	else
+		return nullptr;
+	if (end - p < length)
+		return nullptr;
+	// Only the second byte has a narrower range
+	unsigned char second = (unsigned char)p[1];
+	if (second < low || second > high)
+		return nullptr;
+	for (int i = 2; i < length; i++)
+		if (((unsigned char)p[i] & 0xC0) != 0x80)
+			return nullptr;
+	return p + length;
+}
+
+static const char* scalarValidateUtf8(const char* begin, const char* end)
+{
+	while (begin < end)
+	{
+		if ((unsigned char)*begin < 0x80)
+			begin++;
+		else
+		{
+			const char* next = utf8Character(begin, end);
+			if (next == nullptr)
+				return begin;
+			begin = next;
+		}
+	}
+	return begin;
+}
+
+static const Scanner scalar = { "scalar", scalarSkip, scalarFind, scalarCountNewlines, scalarValidateUtf8 };
+
+const Scanner& scalarScanner()
+{
+	return scalar;
+}
+
+#ifdef SCANNER_X86
+
+static inline int countTrailingZeros(uint32_t mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (int)index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+static inline int highestBit(uint32_t mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanReverse(&index, mask);
+	return (int)index;
+#else
+	return 31 - __builtin_clz(mask);
+#endif
+}
+
+static inline int popCount(uint32_t mask)
+{
+	// Portable bit trick, not every SSE2 machine has POPCNT
+	mask = mask - ((mask >> 1) & 0x55555555);
+	mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+	return (int)((((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+}
+
+// Signed compares double as range checks since every byte of interest is below 0x80
+static inline __m128i sse2InRange(__m128i block, char low, char high)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(low - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8(high + 1)));
+}
+
+static inline uint32_t sse2Mask(const char* p, CharClass type)
+{
+	__m128i block = _mm_loadu_si128((const __m128i*)p);
+	__m128i match;
+	switch (type)
+	{
+	case CharClass::Whitespace:
+		match = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+			_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))));
+		break;
+	case CharClass::Identifier:
+		// Or-ing the block in sets the top bit of every byte from 0x80 up
+		match = _mm_or_si128(
+			_mm_or_si128(sse2InRange(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 'z'), sse2InRange(block, '0', '9')),
+			_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('_')), block));
+		break;
+	case CharClass::Digit:
+		match = sse2InRange(block, '0', '9');
+		break;
+	case CharClass::Newline:
+		match = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+		break;
+	case CharClass::CodeSpecial:
+		match = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('/')));
+		break;
+	default:
+		match = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'))),
+			_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')));
+		break;
+	}
+	return (uint32_t)_mm_movemask_epi8(match);
+}
+
+static const char* sse2Skip(const char* begin, const char* end, CharClass type)
+{
+	for (; end - begin >= 16; begin += 16)
+	{
+		uint32_t mask = ~sse2Mask(begin, type) & 0xFFFF;
+		if (mask != 0)
+			return begin + countTrailingZeros(mask);
+	}
+	return scalarSkip(begin, end, type);
+}
+
+static const char* sse2Find(const char* begin, const char* end, CharClass type)
+{
+	for (; end - begin >= 16; begin += 16)
+	{
+		uint32_t mask = sse2Mask(begin, type);
+		if (mask != 0)
+			return begin + countTrailingZeros(mask);
+	}
+	return scalarFind(begin, end, type);
+}
+
+static size_t sse2CountNewlines(const char* begin, const char* end, const char*& lastNewline)
+{
+	size_t count = 0;
+	for (; end - begin >= 16; begin += 16)
+	{
+		uint32_t mask = sse2Mask(begin, CharClass::Newline);
+		if (mask != 0)
+		{
+			count += popCount(mask);
+			lastNewline = begin + highestBit(mask);
+		}
+	}
+	return count + scalarCountNewlines(begin, end, lastNewline);
+}
+
+static const char* sse2ValidateUtf8(const char* begin, const char* end)
+{
+	while (end - begin >= 16)
+	{
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)begin));
+		if (mask == 0)
+		{
+			begin += 16;
+			continue;
+		}
+		begin += countTrailingZeros(mask);
+		const char* next = utf8Character(begin, end);
+		if (next == nullptr)
+			return begin;
+		begin = next;
+	}
+	return scalarValidateUtf8(begin, end);
+}
+
+TARGET_AVX2 static inline __m256i avx2InRange(__m256i block, char low, char high)
+{
+	return _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8(low - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), block));
+}
+
+TARGET_AVX2 static inline uint32_t avx2Mask(const char* p, CharClass type)
+{
+	__m256i block = _mm256_loadu_si256((const __m256i*)p);
+	__m256i match;
+	switch (type)
+	{
+	case CharClass::Whitespace:
+		match = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'))),
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'))));
+		break;
+	case CharClass::Identifier:
+		match = _mm256_or_si256(
+			_mm256_or_si256(avx2InRange(_mm256_or_si256(block, _mm256_set1_epi8(0x20)), 'a', 'z'), avx2InRange(block, '0', '9')),
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('_')), block));
+		break;
+	case CharClass::Digit:
+		match = avx2InRange(block, '0', '9');
+		break;
+	case CharClass::Newline:
+		match = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+		break;
+	case CharClass::CodeSpecial:
+		match = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/')));
+		break;
+	default:
+		match = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'))),
+			_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n')));
+		break;
+	}
+	return (uint32_t)_mm256_movemask_epi8(match);
+}
+
+TARGET_AVX2 static const char* avx2Skip(const char* begin, const char* end, CharClass type)
+{
+	for (; end - begin >= 32; begin += 32)
+	{
+		uint32_t mask = ~avx2Mask(begin, type);
+		if (mask != 0)
+			return begin + countTrailingZeros(mask);
+	}
+	return sse2Skip(begin, end, type);
+}
+
+TARGET_AVX2 static const char* avx2Find(const char* begin, const char* end, CharClass type)
+{
+	for (; end - begin >= 32; begin += 32)
+	{
+		uint32_t mask = avx2Mask(begin, type);
+		if (mask != 0)
+			return begin + countTrailingZeros(mask);
+	}
+	return sse2Find(begin, end, type);
+}
+
+TARGET_AVX2 static size_t avx2CountNewlines(const char* begin, const char* end, const char*& lastNewline)
+{
+	size_t count = 0;
+	for (; end - begin >= 32; begin += 32)
+	{
+		uint32_t mask = avx2Mask(begin, CharClass::Newline);
+		if (mask != 0)
+		{
+			count += popCount(mask);
+			lastNewline = begin + highestBit(mask);
+		}
+	}
+	return count + sse2CountNewlines(begin, end, lastNewline);
+}
+
+TARGET_AVX2 static const char* avx2ValidateUtf8(const char* begin, const char* end)
+{
+	while (end - begin >= 32)
+	{
+		uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)begin));
+		if (mask == 0)
+		{
+			begin += 32;
+			continue;
+		}
+		begin += countTrailingZeros(mask);
+		const char* next = utf8Character(begin, end);
+		if (next == nullptr)
+			return begin;
+		begin = next;
+	}
+	return sse2ValidateUtf8(begin, end);
+}
+
+static const Scanner sse2 = { "sse2", sse2Skip, sse2Find, sse2CountNewlines, sse2ValidateUtf8 };
+static const Scanner avx2 = { "avx2", avx2Skip, avx2Find, avx2CountNewlines, avx2ValidateUtf8 };
+
+static void cpuid(int leaf, int subLeaf, int registers[4])
+{
+#ifdef _MSC_VER
+	__cpuidex(registers, leaf, subLeaf);
+#else
+	__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+static bool hasSse2()
+{
+	int registers[4];
+	cpuid(1, 0, registers);
+	return (registers[3] & (1 << 26)) != 0;
+}
+
+static bool hasAvx2()
+{
+	int registers[4];
+	cpuid(0, 0, registers);
+	if (registers[0] < 7)
+		return false;
+	cpuid(1, 0, registers);
+	bool osxsave = (registers[2] & (1 << 27)) != 0;
+	bool avx = (registers[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx)
+		return false;
+	// The OS has to save the YMM registers on context switches as well
+#ifdef _MSC_VER
+	unsigned long long xcr0 = _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	unsigned long long xcr0 = ((unsigned long long)edx << 32) | eax;
+#endif
+	if ((xcr0 & 0x6) != 0x6)
+		return false;
+	cpuid(7, 0, registers);
+	return (registers[1] & (1 << 5)) != 0;
+}
+
+const Scanner* sse2Scanner()
+{
+	static const bool supported = hasSse2();
+	return supported ? &sse2 : nullptr;
+}
+
+const Scanner* avx2Scanner()
+{
+	static const bool supported = hasSse2() && hasAvx2();
+	return supported ? &avx2 : nullptr;
+}
+
+#else
+
+const Scanner* sse2Scanner()
+{
+	return nullptr;
+}
+
+const Scanner* avx2Scanner()
+{
+	return nullptr;
+}
+
+#endif
+
+const Scanner& scanner()
+{
+	static const Scanner& best = avx2Scanner() ? *avx2Scanner() : sse2Scanner() ? *sse2Scanner() : scalar;
+	return best;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+enum class CharClass
+{
+	Whitespace,    // ' ', '\t', '\r', '\n'
+	Identifier,    // letters, digits, '_' and every byte of a multi-byte UTF-8 character
+	Digit,
+	Newline,
+	StringSpecial, // '"', '\\' and '\n', the bytes a string literal has to stop at
+	CodeSpecial    // '"' and '/', the bytes that can start a string or a comment
+};
+
+// Byte run scanners for the Tokenizer. There is a scalar version and on x86 an
+// SSE2 and an AVX2 version working on 16/32 byte blocks, scanner() picks the
+// widest one the CPU supports through CPUID the first time it is called.
+struct Scanner
+{
+	const char* name;
+
+	// First byte in [begin, end) that is not in the class, or end
+	const char* (*skip)(const char* begin, const char* end, CharClass type);
+	// First byte in [begin, end) that is in the class, or end
+	const char* (*find)(const char* begin, const char* end, CharClass type);
+	// Number of '\n' in [begin, end), lastNewline is left alone when there are none
+	size_t (*countNewlines)(const char* begin, const char* end, const char*& lastNewline);
+	// First byte in [begin, end) that is not part of well formed UTF-8, or end.
+	// Runs of ASCII are skipped a block at a time, only multi-byte characters
+	// are decoded
+	const char* (*validateUtf8)(const char* begin, const char* end);
+};
+
+const Scanner& scanner();
+const Scanner& scalarScanner();
+// Null when the CPU or the build does not support them
+const Scanner* sse2Scanner();
+const Scanner* avx2Scanner();
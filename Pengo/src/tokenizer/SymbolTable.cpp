@@ -0,0 +1,17 @@
+#include "SymbolTable.h"
+
+SymbolTable& SymbolTable::global()
+{
+	static SymbolTable table;
+	return table;
+}
+
+Atom SymbolTable::intern(std::string_view name)
+{
+	auto it = m_atoms.find(name);
+	if (it != m_atoms.end())
+		return it->second;
+	Atom atom = (Atom)m_names.size();
+	m_atoms.emplace(m_names.emplace_back(name), atom);
+	return atom;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Dense id of an interned identifier, equal ids mean equal names
+using Atom = uint32_t;
+
+// Interns identifiers once in the tokenizer so every later stage compares and
+// hashes atoms instead of strings. The names are owned by the table, atoms stay
+// valid after the source buffer is gone.
+class SymbolTable
+{
+public:
+	static SymbolTable& global();
+
+	Atom intern(std::string_view name);
+	inline std::string_view name(Atom atom) const { return m_names[atom]; }
+	inline size_t size() const { return m_names.size(); }
+private:
+	std::unordered_map<std::string_view, Atom> m_atoms;
+	// Deque so the views used as keys above never move
+	std::deque<std::string> m_names;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <string>
+#include "SymbolTable.h"
+
+#include <string_view>
 
 enum class TokenType
 {
@@ -48,10 +50,22 @@ enum class TokenType
 	_EOF
 };
 
+// The token text is a view into the source buffer, or for string literals whose
+// escapes had to be decoded into the storage of whichever owns the decoded
+// strings: the Tokenizer that scanned them, or the TokenBuffer they were drained
+// into. Tokens are only valid while both the source and that owner are alive.
 struct Token
 {
 	TokenType type = TokenType::_EOF;
-	std::string token;
-	int line;
-	int pos;
+	std::string_view token;
+	// Source offset just past the token, a LineIndex turns it into a line and pos
+	int offset = 0;
+	// Decoded once by the tokenizer, which member is set depends on the type
+	union
+	{
+		Atom atom = 0; // Identifier
+		int integer; // Integer
+		float decimal; // Float
+		bool boolean; // Bool
+	};
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "TokenBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+Token TokenBuffer::Cursor::next()
+{
+	if (m_hasPeeked)
+	{
+		m_hasPeeked = false;
+		return m_peeked;
+	}
+	Token current = token();
+	advance();
+	return current;
+}
+
+const Token& TokenBuffer::Cursor::peek()
+{
+	if (!m_hasPeeked)
+	{
+		m_peeked = next();
+		m_hasPeeked = true;
+	}
+	return m_peeked;
+}
+
+void TokenBuffer::push(const Token& token, uint32_t start, uint32_t end)
+{
+	// Strings are stored without their quotes, like the token text
+	if (token.type == TokenType::String)
+	{
+		start++;
+		end--;
+	}
+	uint32_t payload;
+	std::memcpy(&payload, &token.atom, sizeof(payload));
+	if (token.type == TokenType::String && token.token.data() != m_source.data() + start)
+		payload = ++m_decodedPushed;
+	m_types.push_back((uint8_t)token.type);
+	m_offsets.push_back(start);
+	m_lengths.push_back(end - start);
+	m_payloads.push_back(payload);
+}
+
+void TokenBuffer::adoptDecoded(std::deque<std::string>&& decoded)
+{
+	for (std::string& text : decoded)
+		m_decoded.push_back(std::move(text));
+	decoded.clear();
+}
+
+uint32_t TokenBuffer::takeDecoded(TokenBuffer& from)
+{
+	uint32_t base = (uint32_t)m_decoded.size();
+	for (std::string& decoded : from.m_decoded)
+		m_decoded.push_back(std::move(decoded));
+	from.m_decoded.clear();
+	return base;
+}
+
+void TokenBuffer::place(size_t at, const TokenBuffer& from, size_t count, uint32_t sourceOffset, const Atom* atoms, uint32_t decodedBase)
+{
+	std::copy_n(from.m_types.begin(), count, m_types.begin() + at);
+	std::copy_n(from.m_lengths.begin(), count, m_lengths.begin() + at);
+	for (size_t i = 0; i < count; i++)
+	{
+		m_offsets[at + i] = from.m_offsets[i] + sourceOffset;
+		uint32_t payload = from.m_payloads[i];
+		if (from.type(i) == TokenType::Identifier)
+			payload = atoms[payload];
+		else if (from.type(i) == TokenType::String && payload != 0)
+			payload += decodedBase;
+		m_payloads[at + i] = payload;
+	}
+}
+
+void TokenBuffer::resize(size_t size)
+{
+	m_types.resize(size);
+	m_offsets.resize(size);
+	m_lengths.resize(size);
+	m_payloads.resize(size);
+}
+
+std::string_view TokenBuffer::text(size_t index) const
+{
+	if (type(index) == TokenType::String && m_payloads[index] != 0)
+		return m_decoded[m_payloads[index] - 1];
+	return m_source.substr(m_offsets[index], m_lengths[index]);
+}
+
+Token TokenBuffer::operator[](size_t index) const
+{
+	Token token;
+	token.type = type(index);
+	token.token = text(index);
+	token.offset = (int)endOf(index);
+	if (token.type != TokenType::String)
+		std::memcpy(&token.atom, &m_payloads[index], sizeof(uint32_t));
+	return token;
+}
+
+uint32_t TokenBuffer::endOf(size_t index) const
+{
+	// Add back the closing quote
+	return m_offsets[index] + m_lengths[index] + (type(index) == TokenType::String ? 1 : 0);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Token.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A whole token stream stored as parallel arrays, so a pass that only looks at
+// token types walks one dense byte array. Text is kept as source offsets and
+// lengths, a LineIndex over the source gives their lines and positions.
+class TokenBuffer
+{
+public:
+	// Reads a buffer front to back. The parser only looks at type() until it shifts
+	// the token, next()/peek() are the same interface the Tokenizer has
+	class Cursor
+	{
+	public:
+		Cursor(const TokenBuffer& buffer) : m_buffer(&buffer) { }
+
+		inline TokenType type() const { return (TokenType)m_buffer->types()[m_index]; }
+		inline Token token() const { return (*m_buffer)[m_index]; }
+		// Stays on the trailing _EOF once it is reached
+		inline void advance() { if (m_index + 1 < m_buffer->size()) m_index++; }
+
+		Token next();
+		const Token& peek();
+	private:
+		const TokenBuffer* m_buffer;
+		size_t m_index = 0;
+		Token m_peeked;
+		bool m_hasPeeked = false;
+	};
+
+	// The source is borrowed, it has to outlive the buffer
+	TokenBuffer(std::string_view source = {}) : m_source(source) { }
+
+	// start and end are the source range the token was scanned from. A string
+	// whose escapes were decoded is numbered, its text comes from adoptDecoded()
+	void push(const Token& token, uint32_t start, uint32_t end);
+	// Takes over the decoded strings of the tokens pushed so far, in push order
+	void adoptDecoded(std::deque<std::string>&& decoded);
+	// Moves the decoded strings of a buffer over, returns the base to place() it with
+	uint32_t takeDecoded(TokenBuffer& from);
+	// Copies count tokens of a buffer over a slice of this buffer's source that
+	// begins at sourceOffset, identifier atoms are mapped through atoms
+	void place(size_t at, const TokenBuffer& from, size_t count, uint32_t sourceOffset, const Atom* atoms, uint32_t decodedBase);
+	void resize(size_t size);
+
+	inline size_t size() const { return m_types.size(); }
+	inline const uint8_t* types() const { return m_types.data(); }
+	inline TokenType type(size_t index) const { return (TokenType)m_types[index]; }
+	std::string_view text(size_t index) const;
+	// Where the token ended in the source, its position is reported from there
+	uint32_t endOf(size_t index) const;
+
+	Token operator[](size_t index) const;
+	inline Cursor cursor() const { return Cursor(*this); }
+private:
+	std::string_view m_source;
+	std::vector<uint8_t> m_types;
+	std::vector<uint32_t> m_offsets, m_lengths;
+	// The token's atom, integer, decimal or boolean bits. Strings whose escapes
+	// were decoded store their index in m_decoded plus one
+	std::vector<uint32_t> m_payloads;
+	// Deque so the views handed out stay valid
+	std::deque<std::string> m_decoded;
+	uint32_t m_decodedPushed = 0;
+};
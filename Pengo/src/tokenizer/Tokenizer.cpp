@@ -1,36 +1,76 @@
 #pragma once
 
 #include "Tokenizer.h"
-#include <unordered_map>
+#include "Keywords.h"
 #include <iostream>
+#include <charconv>
+#include <cstring>
 
-const std::unordered_map<std::string, TokenType> keywords = {
-	{"true", TokenType::Bool},
-	{"false", TokenType::Bool},
+Tokenizer::Tokenizer(std::string_view source, const Scanner& scan) :
+	m_source(source), m_whole(source), m_scan(scan), m_symbols(SymbolTable::global())
+{
+	validateUtf8();
+}
 
-	{"if", TokenType::If},
-	{"elif", TokenType::ElseIf},
-	{"else", TokenType::Else},
-	{"while", TokenType::While},
-	{"func", TokenType::Func},
+Tokenizer::Tokenizer(std::string_view source, std::string_view whole, SymbolTable& symbols, const Scanner& scan) :
+	m_source(source), m_whole(whole), m_scan(scan), m_symbols(symbols), m_base((int)(source.data() - whole.data()))
+{
+	validateUtf8();
+}
 
-	{"return", TokenType::Return},
-	{"break", TokenType::Break},
-	{"continue", TokenType::Continue},
-};
+Token Tokenizer::next()
+{
+	if (m_hasPeeked)
+	{
+		m_hasPeeked = false;
+		return m_peeked;
+	}
+	return scan();
+}
 
-Tokenizer::Tokenizer(const std::string& source) : m_source(source)
-{ }
+const Token& Tokenizer::peek()
+{
+	if (!m_hasPeeked)
+	{
+		m_peeked = scan();
+		m_hasPeeked = true;
+	}
+	return m_peeked;
+}
+
+void Tokenizer::seek(int offset)
+{
+	m_current = offset;
+	m_hasPeeked = false;
+}
+
+TokenBuffer Tokenizer::tokenize()
+{
+	TokenBuffer tokens(m_source);
+	Token token;
+	do
+	{
+		token = next();
+		tokens.push(token, m_start, m_current);
+	}
+	while (token.type != TokenType::_EOF);
+	tokens.adoptDecoded(std::move(m_decoded));
+	return tokens;
+}
 
-std::vector<Token> Tokenizer::tokenize()
+Token Tokenizer::scan()
 {
-	while (!isAtEnd())
+	// Whitespace and comments produce no token, keep going until one is added
+	m_hasToken = false;
+	while (!m_hasToken)
 	{
 		m_start = m_current;
-		nextToken();
+		if (isAtEnd())
+			addToken(TokenType::_EOF);
+		else
+			nextToken();
 	}
-	addToken(TokenType::_EOF);
-	return m_tokens;
+	return m_token;
 }
 
 void Tokenizer::nextToken()
@@ -39,14 +79,14 @@ void Tokenizer::nextToken()
 
 	switch (next)
 	{
-	case ' ': break;
-	case '\t': break;
+	case ' ':
+	case '\t':
 	case '\r':
-	case '\n': m_line++; m_lineCurrent = 0; break;
+	case '\n': skipWhitespace(); break;
 	case '+': addToken(TokenType::Plus); break;
 	case '-': addToken(TokenType::Minus); break;
 	case '*': addToken(TokenType::Asterisk); break;
-	case '/': if (match('/')) { while (!match('\n') && !isAtEnd()) advance(); break; }
+	case '/': if (match('/')) { skipComment(); break; }
 			else addToken(TokenType::Slash); break;
 	case '(': addToken(TokenType::LeftParen); break;
 	case ')': addToken(TokenType::RightParen); break;
@@ -70,74 +110,177 @@ void Tokenizer::nextToken()
 			tokenizeIdentifier();
 			break;
 		}
-		std::cout << "Could not parse at line " << m_line << " position " << m_lineCurrent << "!" << std::endl;
+		LineIndex::Location at = locate(m_current);
+		std::cout << "Could not parse at line " << at.line << " position " << at.pos << "!" << std::endl;
+		exit(-51);
+	}
+}
+
+void Tokenizer::validateUtf8()
+{
+	const char* invalid = m_scan.validateUtf8(m_source.data(), sourceEnd());
+	if (invalid < sourceEnd())
+	{
+		LineIndex::Location at = locate(offsetOf(invalid) + 1);
+		std::cout << "Invalid UTF-8 at line " << at.line << " position " << at.pos << "!" << std::endl;
 		exit(-51);
 	}
 }
 
+void Tokenizer::skipWhitespace()
+{
+	m_current = offsetOf(m_scan.skip(here(), sourceEnd(), CharClass::Whitespace));
+}
+
+void Tokenizer::skipComment()
+{
+	m_current = offsetOf(m_scan.find(here(), sourceEnd(), CharClass::Newline));
+}
+
+LineIndex::Location Tokenizer::locate(int offset) const
+{
+	return LineIndex(m_whole).locate(m_base + offset);
+}
+
 void Tokenizer::tokenizeNumber()
 {
-	while (isNumeric(peek())) advance();
+	m_current = offsetOf(m_scan.skip(here(), sourceEnd(), CharClass::Digit));
 	if (match('.'))
 	{
-		while (isNumeric(peek())) advance();
+		m_current = offsetOf(m_scan.skip(here(), sourceEnd(), CharClass::Digit));
 		addToken(TokenType::Float);
+		decodeNumber(m_token.decimal);
+	}
+	else
+	{
+		addToken(TokenType::Integer);
+		decodeNumber(m_token.integer);
 	}
-	else addToken(TokenType::Integer);
 }
 
-void Tokenizer::tokenizeString()
+template<typename T>
+void Tokenizer::decodeNumber(T& value)
 {
-	while (peek() != '"' && !isAtEnd()) {
-		if (peek() == '\n') {
-			m_line++;
-			m_lineCurrent = 0;
-		}
-		advance();
-	}
-	advance();
-	std::string token = m_source.substr(m_start+1, (m_current - m_start)-2);
-	size_t pos;
-	while ((pos = token.find('\\')) != std::string::npos) {
-		if (token.size() >= pos+1 && token.substr(pos, 2) == "\\n")
-			token.replace(pos, 2, "\n");
+	std::string_view text = m_token.token;
+	auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+	if (error != std::errc())
+	{
+		LineIndex::Location at = LineIndex(m_whole).locate(m_token.offset);
+		std::cout << "Number " << text << " out of range at line " << at.line << " position " << at.pos << "!" << std::endl;
+		exit(-51);
 	}
-	addToken(TokenType::String, token);
 }
 
-void Tokenizer::tokenizeIdentifier()
+void Tokenizer::tokenizeString()
 {
-	while (isAlpha(peek()) || isNumeric(peek())) advance();
-
-	std::string token = m_source.substr(m_start, m_current - m_start);
-	if (keywords.find(token) != keywords.end())
+	bool escaped = false;
+	while (true)
 	{
-		addToken(keywords.at(token));
+		m_current = offsetOf(m_scan.find(here(), sourceEnd(), CharClass::StringSpecial));
+		if (isAtEnd())
+		{
+			LineIndex::Location at = locate(m_current);
+			std::cout << "Unterminated string at line " << at.line << " position " << at.pos << "!" << std::endl;
+			exit(-51);
+		}
+		char next = advance();
+		if (next == '"')
+			break;
+		if (next == '\\')
+		{
+			// The escaped character cannot end the literal
+			escaped = true;
+			if (!isAtEnd())
+				m_current++;
+		}
 	}
+	std::string_view token = m_source.substr(m_start + 1, (m_current - m_start) - 2);
+	if (!escaped)
+		addToken(TokenType::String, token);
 	else
+		addToken(TokenType::String, decodeEscapes(token));
+}
+
+std::string_view Tokenizer::decodeEscapes(std::string_view raw)
+{
+	// Escapes only ever shrink the text so one buffer of the raw size is enough
+	std::string& decoded = m_decoded.emplace_back(raw.size(), '\0');
+	char* out = decoded.data();
+	const char* p = raw.data();
+	const char* end = p + raw.size();
+	while (p < end)
 	{
-		addToken(TokenType::Identifier, token);
+		const char* slash = (const char*)std::memchr(p, '\\', end - p);
+		if (slash == nullptr)
+			slash = end;
+		std::memcpy(out, p, slash - p);
+		out += slash - p;
+		if (slash == end)
+			break;
+		p = slash + 1;
+		char escape = p < end ? *p++ : '\0';
+		switch (escape)
+		{
+		case 'n': *out++ = '\n'; break;
+		case 't': *out++ = '\t'; break;
+		case 'r': *out++ = '\r'; break;
+		case '0': *out++ = '\0'; break;
+		case '"': *out++ = '"'; break;
+		case '\\': *out++ = '\\'; break;
+		case 'x':
+		{
+			int high = end - p >= 2 ? hexValue(p[0]) : -1;
+			int low = end - p >= 2 ? hexValue(p[1]) : -1;
+			if (high < 0 || low < 0)
+			{
+				LineIndex::Location at = locate(m_current);
+				std::cout << "Expected two hex digits after \\x in string at line " << at.line << " position " << at.pos << "!" << std::endl;
+				exit(-51);
+			}
+			*out++ = (char)(high * 16 + low);
+			p += 2;
+		}
+		break;
+		default:
+			LineIndex::Location at = locate(m_current);
+			std::cout << "Unknown escape sequence in string at line " << at.line << " position " << at.pos << "!" << std::endl;
+			exit(-51);
+		}
 	}
+	decoded.resize(out - decoded.data());
+	return decoded;
 }
 
-void Tokenizer::addToken(TokenType type)
+void Tokenizer::tokenizeIdentifier()
 {
-	addToken(type, m_source.substr(m_start, m_current - m_start));
+	m_current = offsetOf(m_scan.skip(here(), sourceEnd(), CharClass::Identifier));
+
+	std::string_view word = m_source.substr(m_start, m_current - m_start);
+	TokenType type = keywordType(word);
+	addToken(type, word);
+	if (type == TokenType::Identifier)
+		m_token.atom = m_symbols.intern(word);
+	else if (type == TokenType::Bool)
+		m_token.boolean = word == "true";
 }
 
-void Tokenizer::addToken(TokenType type, std::string token)
+void Tokenizer::addToken(TokenType type)
 {
-	m_tokens.push_back({ type, token, m_line, m_lineCurrent });
+	addToken(type, m_source.substr(m_start, m_current - m_start));
 }
 
-char Tokenizer::peek()
+void Tokenizer::addToken(TokenType type, std::string_view token)
 {
-	return m_source[m_current];
+	// Reset first so no payload of the last token is left in the union
+	m_token = Token();
+	m_token.type = type;
+	m_token.token = token;
+	m_token.offset = m_base + m_current;
+	m_hasToken = true;
 }
 
 char Tokenizer::advance()
 {
-	m_lineCurrent++;
 	return m_source[m_current++];
 }
 
@@ -147,7 +290,6 @@ bool Tokenizer::match(char matchee)
 		return false;
 	if (m_source[m_current] == matchee)
 	{
-		m_lineCurrent++;
 		m_current++;
 		return true;
 	}
@@ -163,10 +305,20 @@ bool Tokenizer::isAlpha(char val)
 {
 	return ('a' <= val && val <= 'z') ||
 		('A' <= val && val <= 'Z') ||
-		val == '_';
+		val == '_' ||
+		(unsigned char)val >= 0x80;
 }
 
 bool Tokenizer::isAtEnd()
 {
 	return m_current >= (int) m_source.size();
+}
+
+int Tokenizer::hexValue(char c)
+{
+	if ('0' <= c && c <= '9')
+		return c - '0';
+	if ('a' <= (c | 0x20) && (c | 0x20) <= 'f')
+		return (c | 0x20) - 'a' + 10;
+	return -1;
 }
\ No newline at end of file
@@ -1,37 +1,74 @@
 #pragma once
 
 #include "Token.h"
+#include "TokenBuffer.h"
+#include "Scanner.h"
+#include "LineIndex.h"
 
+#include <deque>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class Tokenizer
 {
 public:
-	Tokenizer(const std::string& source);
+	// The source is borrowed, it has to outlive the tokenizer and its tokens. It
+	// is checked to be UTF-8 up front, so a byte from 0x80 up is always part of a
+	// whole character and can be taken as an identifier or string byte
+	Tokenizer(std::string_view source, const Scanner& scan = scanner());
+	// For a slice of a larger source, offsets and errors are relative to the whole
+	Tokenizer(std::string_view source, std::string_view whole, SymbolTable& symbols, const Scanner& scan = scanner());
 
-	std::vector<Token> tokenize();
+	// Pulls tokens one at a time, after the end every call returns _EOF
+	Token next();
+	const Token& peek();
+	// Continues from an offset outside of any token or literal, like the end of a statement
+	void seek(int offset);
+
+	// Drains the whole stream, including the trailing _EOF, into a buffer over
+	// the same source. The buffer takes the decoded strings, so it can outlive the
+	// tokenizer. Has to be called before anything was pulled
+	TokenBuffer tokenize();
 private:
-	std::string m_source;
-	int m_start = 0, m_current = 0, m_lineCurrent = 0;
-	int m_line = 1;
+	std::string_view m_source, m_whole;
+	const Scanner& m_scan;
+	SymbolTable& m_symbols;
+	int m_start = 0, m_current = 0;
+	// Offset of the source in the whole
+	int m_base = 0;
 
-	std::vector<Token> m_tokens;
+	Token m_token, m_peeked;
+	bool m_hasToken = false, m_hasPeeked = false;
+	// String literals with escapes, deque so the views handed out stay valid
+	std::deque<std::string> m_decoded;
 
+	Token scan();
 	void nextToken();
 
 	void addToken(TokenType type);
-	void addToken(TokenType type, std::string token);
+	void addToken(TokenType type, std::string_view token);
 
-	char peek();
 	char advance();
 	bool match(char matchee);
 
+	void validateUtf8();
+	void skipWhitespace();
+	void skipComment();
+	// Where an error at an offset of the source is, only looked up before exiting
+	LineIndex::Location locate(int offset) const;
+	inline const char* here() const { return m_source.data() + m_current; }
+	inline const char* sourceEnd() const { return m_source.data() + m_source.size(); }
+	inline int offsetOf(const char* p) const { return (int)(p - m_source.data()); }
+
 	void tokenizeNumber();
+	template<typename T> void decodeNumber(T& value);
 	void tokenizeString();
+	std::string_view decodeEscapes(std::string_view raw);
 	void tokenizeIdentifier();
 
 	bool isNumeric(char val);
 	bool isAlpha(char val);
+	int hexValue(char c);
 	bool isAtEnd();
 };
\ No newline at end of file